@@ -0,0 +1,133 @@
+// Compares re-deriving BMI and body fat for a whole history through the
+// per-object BodyComposition calculations against BodyCompositionBatch,
+// then the array kernels on one thread against calling them row by row,
+// which isolates what vectorization contributes.
+//
+// Usage: bench-bodycomposition-batch [--json <file>] [--filter <substring>]
+//                                    [--min-time-ms <ms>] [--repetitions <n>]
+//                                    [--max-entries <n>]
+
+#include <QCoreApplication>
+#include <QList>
+#include <QRandomGenerator>
+#include "benchharness.h"
+#include "models/bodycomposition.h"
+#include "models/bodycompositionbatch.h"
+
+static QList<BodyComposition> makeHistory(int count)
+{
+    QRandomGenerator rng(42);
+    QList<BodyComposition> history;
+    history.reserve(count);
+
+    QDate date(1980, 1, 1);
+    for (int i = 0; i < count; ++i) {
+        double weight = 160.0 + rng.bounded(60.0);
+        double waist = 30.0 + rng.bounded(12.0);
+        double neck = 14.0 + rng.bounded(4.0);
+        history.append(BodyComposition(date.addDays(i), weight, waist, 70.0, neck));
+    }
+    return history;
+}
+
+struct Columns
+{
+    QList<double> weight;
+    QList<double> waist;
+    QList<double> height;
+    QList<double> neck;
+    QList<unsigned char> isMale;
+    QList<double> bmi;
+    QList<double> bodyFat;
+};
+
+static Columns makeColumns(const QList<BodyComposition> &history)
+{
+    Columns columns;
+    for (const BodyComposition &composition : history) {
+        columns.weight.append(composition.weight());
+        columns.waist.append(composition.waistCircumference());
+        columns.height.append(composition.height());
+        columns.neck.append(composition.neckCircumference());
+        columns.isMale.append(composition.isMale() ? 1 : 0);
+    }
+    columns.bmi.resize(history.size());
+    columns.bodyFat.resize(history.size());
+    return columns;
+}
+
+static void perObject(QList<BodyComposition> &history)
+{
+    for (BodyComposition &composition : history) {
+        composition.calculateBMI();
+        composition.calculateBodyFat();
+    }
+}
+
+static void batch(QList<BodyComposition> &history)
+{
+    BodyCompositionBatch batch;
+    batch.reserve(history.size());
+    for (const BodyComposition &composition : history) {
+        batch.append(composition);
+    }
+    batch.compute();
+    for (qsizetype i = 0; i < history.size(); ++i) {
+        history[i].setBMI(batch.bmi(i));
+        history[i].setBodyFatPercentage(batch.bodyFatPercentage(i));
+    }
+}
+
+static void perRowKernels(Columns &columns)
+{
+    for (qsizetype i = 0; i < columns.weight.size(); ++i) {
+        columns.bmi[i] = BodyCompositionBatch::bmiFor(columns.weight.at(i), columns.height.at(i));
+        columns.bodyFat[i] = BodyCompositionBatch::bodyFatFor(columns.waist.at(i), columns.neck.at(i),
+                                                              columns.height.at(i), columns.isMale.at(i));
+    }
+}
+
+static void arrayKernels(Columns &columns)
+{
+    const qsizetype count = columns.weight.size();
+    BodyCompositionBatch::computeBMI(columns.weight.constData(), columns.height.constData(),
+                                     columns.bmi.data(), count);
+    BodyCompositionBatch::computeBodyFat(columns.waist.constData(), columns.neck.constData(),
+                                         columns.height.constData(), columns.isMale.constData(),
+                                         columns.bodyFat.data(), count);
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QStringList arguments = app.arguments();
+
+    int maxEntries = 1000000;
+    int maxEntriesIndex = arguments.indexOf("--max-entries");
+    if (maxEntriesIndex >= 0 && maxEntriesIndex + 1 < arguments.size()) {
+        maxEntries = arguments.at(maxEntriesIndex + 1).toInt();
+    }
+
+    BenchHarness harness("bench-bodycomposition-batch", arguments);
+    for (int entries = 1000; entries <= maxEntries; entries *= 10) {
+        QList<BodyComposition> history = makeHistory(entries);
+        Columns columns = makeColumns(history);
+        const QString suffix = QString("/%1").arg(entries);
+
+        harness.run("BodyComposition::calculate/perObject" + suffix, [&]() {
+            perObject(history);
+        });
+        harness.run("BodyCompositionBatch::compute" + suffix, [&]() {
+            batch(history);
+        });
+
+        // One thread: row-by-row calls against the vectorized loops
+        harness.run("BodyCompositionBatch::kernels/perRow" + suffix, [&]() {
+            perRowKernels(columns);
+        });
+        harness.run("BodyCompositionBatch::kernels/arrays" + suffix, [&]() {
+            arrayKernels(columns);
+        });
+    }
+    return harness.finish();
+}
@@ -0,0 +1,108 @@
+// Data layer benchmarks at several history sizes: loading and saving the
+// data file, workout JSON round trips and validation, saving a workout,
+// and the DataManager queries the journal and charts call on every refresh.
+//
+// Usage: bench-datamanager [--json <file>] [--filter <substring>]
+//                          [--min-time-ms <ms>] [--repetitions <n>]
+//                          [--max-years <n>]
+
+#include <QCoreApplication>
+#include <QJsonObject>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include "benchharness.h"
+#include "datasetgenerator.h"
+#include "models/datamanager.h"
+
+static void benchmarkDataset(BenchHarness &harness, const QString &dataDir, int years)
+{
+    const QString path = QString("%1/data-%2y.json").arg(dataDir).arg(years);
+    DatasetGenerator::Options options;
+    options.years = years;
+    DatasetGenerator(options).writeFile(path);
+
+    DataManager manager(path);
+    const QString suffix = QString("/%1y").arg(years);
+    const QList<Workout> workouts = manager.getAllWorkouts();
+    const QPair<QDate, QDate> range = manager.getDataDateRange();
+    const int spanDays = range.first.daysTo(range.second) + 1;
+
+    harness.run("DataManager::loadData" + suffix, [&]() {
+        manager.loadData();
+    });
+
+    harness.run("DataManager::saveData" + suffix, [&]() {
+        manager.saveData();
+    });
+
+    QList<QJsonObject> workoutJson;
+    for (const Workout &workout : workouts) {
+        workoutJson.append(workout.toJson());
+    }
+    int next = 0;
+
+    harness.run("Workout::toJson" + suffix, [&]() {
+        benchKeep(workouts.at(next++ % workouts.size()).toJson());
+    });
+
+    harness.run("Workout::fromJson" + suffix, [&]() {
+        benchKeep(Workout::fromJson(workoutJson.at(next++ % workoutJson.size())));
+    });
+
+    QRandomGenerator rng(7);
+    harness.run("DataManager::getWorkoutsByDate" + suffix, [&]() {
+        benchKeep(manager.getWorkoutsByDate(range.first.addDays(rng.bounded(spanDays))));
+    });
+
+    harness.run("DataManager::getBodyCompositionRange/90d" + suffix, [&]() {
+        QDate start = range.first.addDays(rng.bounded(qMax(1, spanDays - 90)));
+        benchKeep(manager.getBodyCompositionRange(start, start.addDays(89)));
+    });
+
+    harness.run("DataManager::getBodyCompositionRange/all" + suffix, [&]() {
+        benchKeep(manager.getBodyCompositionRange(range.first, range.second));
+    });
+
+    harness.run("DataManager::getWeightRange" + suffix, [&]() {
+        benchKeep(manager.getWeightRange());
+    });
+
+    harness.run("DataManager::getNextWorkoutId" + suffix, [&]() {
+        benchKeep(manager.getNextWorkoutId());
+    });
+
+    harness.run("Workout::validationErrors" + suffix, [&]() {
+        benchKeep(workouts.at(next++ % workouts.size()).validationErrors());
+    });
+
+    // Re-saving an unchanged workout: reindexing plus a full file write
+    harness.run("DataManager::saveWorkout" + suffix, [&]() {
+        manager.saveWorkout(workouts.at(next++ % workouts.size()));
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QStringList arguments = app.arguments();
+
+    int maxYears = 50;
+    int maxYearsIndex = arguments.indexOf("--max-years");
+    if (maxYearsIndex >= 0 && maxYearsIndex + 1 < arguments.size()) {
+        maxYears = arguments.at(maxYearsIndex + 1).toInt();
+    }
+
+    QTemporaryDir dataDir;
+    if (!dataDir.isValid()) {
+        fprintf(stderr, "Cannot create a temporary directory\n");
+        return 1;
+    }
+
+    BenchHarness harness("bench-datamanager", arguments);
+    for (int years : {1, 10, 50}) {
+        if (years <= maxYears) {
+            benchmarkDataset(harness, dataDir.path(), years);
+        }
+    }
+    return harness.finish();
+}
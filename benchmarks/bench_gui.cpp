@@ -0,0 +1,241 @@
+// End-to-end GUI benchmarks on generated 1, 10 and 50 year histories:
+// chart refreshes per time range, painting every chart page, journal tab
+// switches, date navigation and WorkoutView updates. Widgets are driven
+// the way the application drives them and painted synchronously, so each
+// figure includes the layout and paint work of the frame it causes.
+//
+// Runs on the offscreen platform unless QT_QPA_PLATFORM is set.
+//
+// Usage: bench-gui [--json <file>] [--filter <substring>]
+//                  [--min-time-ms <ms>] [--repetitions <n>]
+//                  [--max-years <n>]
+
+#include <QApplication>
+#include <QComboBox>
+#include <QImage>
+#include <QLoggingCategory>
+#include <QRandomGenerator>
+#include <QSignalBlocker>
+#include <QStyleFactory>
+#include <QTabWidget>
+#include <QTemporaryDir>
+#include "analyticstab.h"
+#include "benchharness.h"
+#include "datasetgenerator.h"
+#include "datemanager.h"
+#include "journalcontentarea.h"
+#include "models/datamanager.h"
+#include "workoutview.h"
+#include <algorithm>
+
+static const QSize WindowSize(1280, 800);
+
+// Runs pending layouts and zero-delay timers, then paints the widget
+// as the next frame would
+static void paint(QWidget *widget)
+{
+    QCoreApplication::processEvents();
+    widget->repaint();
+}
+
+static QComboBox *timeRangeCombo(AnalyticsTab *tab)
+{
+    for (QComboBox *combo : tab->findChildren<QComboBox *>()) {
+        if (combo->findData(30) >= 0 && combo->findData(365) >= 0 && combo->findData(-1) >= 0) {
+            return combo;
+        }
+    }
+    return nullptr;
+}
+
+static void benchmarkAnalytics(BenchHarness &harness, DataManager *manager, const QString &suffix)
+{
+    AnalyticsTab tab(manager);
+    tab.resize(WindowSize);
+    tab.show();
+    paint(&tab);
+
+    // Show every chart page once so each is laid out at its real size
+    QTabWidget *chartTabs = tab.findChild<QTabWidget *>(QString(), Qt::FindDirectChildrenOnly);
+    QList<QWidget *> pages;
+    QList<QImage> images;
+    for (int i = 0; i < chartTabs->count(); ++i) {
+        chartTabs->setCurrentIndex(i);
+        paint(&tab);
+        pages.append(chartTabs->widget(i));
+        images.append(QImage(pages.last()->size(), QImage::Format_ARGB32_Premultiplied));
+    }
+    chartTabs->setCurrentIndex(0);
+
+    QComboBox *ranges = timeRangeCombo(&tab);
+    for (int r = 0; r < ranges->count(); ++r) {
+        int days = ranges->itemData(r).toInt();
+        const QString range = days < 0 ? QString("all") : QString("%1d").arg(days);
+        ranges->setCurrentIndex(r);
+
+        // Charts only apply the points that changed, so each timed refresh
+        // starts from another range's charts; refreshing the same range
+        // again would measure the no-change path
+        const int other = (r + 1) % ranges->count();
+        harness.run("AnalyticsTab::refreshCharts/" + range + suffix, [&]() {
+            QSignalBlocker blocker(ranges);
+            ranges->setCurrentIndex(r);
+            tab.refreshCharts();
+        }, [&]() {
+            QSignalBlocker blocker(ranges);
+            ranges->setCurrentIndex(other);
+            tab.refreshCharts();
+        });
+
+        harness.run("AnalyticsTab::paintCharts/" + range + suffix, [&]() {
+            for (int i = 0; i < pages.size(); ++i) {
+                pages.at(i)->render(&images[i]);
+            }
+        });
+    }
+}
+
+static void benchmarkJournal(BenchHarness &harness, DataManager *manager, const QString &suffix)
+{
+    const QDate lastDate = manager->getDataDateRange().second;
+
+    DateManager dates;
+    dates.setCurrentDate(lastDate);
+    JournalContentArea area(&dates, manager);
+    area.resize(WindowSize);
+    area.show();
+
+    // Open every tab once so the idle warm-up has nothing left to build
+    // in the middle of a measurement
+    QTabWidget *tabs = area.findChild<QTabWidget *>(QString(), Qt::FindDirectChildrenOnly);
+    for (int i = 0; i < tabs->count(); ++i) {
+        tabs->setCurrentIndex(i);
+        paint(&area);
+    }
+
+    harness.run("JournalContentArea::switchTab" + suffix, [&]() {
+        tabs->setCurrentIndex((tabs->currentIndex() + 1) % tabs->count());
+        paint(&area);
+    });
+
+    // Navigation walks back a month and forward again so every step
+    // lands on dates with data
+    tabs->setCurrentIndex(1);
+    paint(&area);
+    int offset = 0;
+    int direction = -1;
+    auto step = [&]() {
+        if (offset + direction < -30 || offset + direction > 0) {
+            direction = -direction;
+        }
+        offset += direction;
+        if (direction < 0) {
+            dates.goToPrevious();
+        } else {
+            dates.goToNext();
+        }
+    };
+
+    harness.run("JournalContentArea::navigate/step" + suffix, [&]() {
+        step();
+        area.flushPendingNavigation();
+        paint(&area);
+    });
+
+    // Holding the arrow key: changes inside the settle window collapse
+    // into one render of the final date
+    harness.run("JournalContentArea::navigate/burst10" + suffix, [&]() {
+        for (int i = 0; i < 10; ++i) {
+            step();
+        }
+        area.flushPendingNavigation();
+        paint(&area);
+    });
+
+    // Opening Visualizations in a fresh window, including building the
+    // journal itself
+    harness.run("JournalContentArea::openVisualizations/cold" + suffix, [&]() {
+        JournalContentArea fresh(&dates, manager);
+        fresh.resize(WindowSize);
+        fresh.show();
+        fresh.findChild<QTabWidget *>(QString(), Qt::FindDirectChildrenOnly)->setCurrentIndex(3);
+        paint(&fresh);
+    });
+}
+
+static void benchmarkWorkoutView(BenchHarness &harness, DataManager *manager, const QString &suffix)
+{
+    QList<QDate> workoutDates;
+    for (const Workout &workout : manager->getAllWorkouts()) {
+        workoutDates.append(workout.date());
+    }
+    std::sort(workoutDates.begin(), workoutDates.end());
+    workoutDates.erase(std::unique(workoutDates.begin(), workoutDates.end()), workoutDates.end());
+    if (workoutDates.isEmpty()) {
+        return;
+    }
+
+    WorkoutView view(manager);
+    view.resize(WindowSize);
+    view.show();
+    view.setDate(workoutDates.last());
+    paint(&view);
+
+    QRandomGenerator rng(7);
+    harness.run("WorkoutView::setDate" + suffix, [&]() {
+        view.setDate(workoutDates.at(rng.bounded(workoutDates.size())));
+        paint(&view);
+    });
+
+    view.setDate(workoutDates.last());
+    harness.run("WorkoutView::refreshData" + suffix, [&]() {
+        view.refreshData();
+        paint(&view);
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    app.setStyle(QStyleFactory::create("Fusion"));
+    QStringList arguments = app.arguments();
+
+    // Keep lazy tab build times and data file paths out of the results
+    QLoggingCategory::setFilterRules("fitness.*.info=false");
+
+    int maxYears = 50;
+    int maxYearsIndex = arguments.indexOf("--max-years");
+    if (maxYearsIndex >= 0 && maxYearsIndex + 1 < arguments.size()) {
+        maxYears = arguments.at(maxYearsIndex + 1).toInt();
+    }
+
+    QTemporaryDir dataDir;
+    if (!dataDir.isValid()) {
+        fprintf(stderr, "Cannot create a temporary directory\n");
+        return 1;
+    }
+
+    BenchHarness harness("bench-gui", arguments);
+    for (int years : {1, 10, 50}) {
+        if (years > maxYears) {
+            continue;
+        }
+
+        // The time ranges count back from today, so the history must too
+        const QString path = QString("%1/data-%2y.json").arg(dataDir.path()).arg(years);
+        DatasetGenerator::Options options;
+        options.years = years;
+        options.endDate = QDate::currentDate();
+        DatasetGenerator(options).writeFile(path);
+
+        DataManager manager(path);
+        const QString suffix = QString("/%1y").arg(years);
+        benchmarkAnalytics(harness, &manager, suffix);
+        benchmarkJournal(harness, &manager, suffix);
+        benchmarkWorkoutView(harness, &manager, suffix);
+    }
+    return harness.finish();
+}
@@ -0,0 +1,291 @@
+#include "benchharness.h"
+#include "utils/allocationcounter.h"
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#ifdef Q_OS_UNIX
+#include <time.h>
+#endif
+
+namespace {
+
+double median(const QList<double> &samples)
+{
+    QList<double> values = samples;
+    std::sort(values.begin(), values.end());
+    qsizetype middle = values.size() / 2;
+    return values.size() % 2 ? values.at(middle) : (values.at(middle - 1) + values.at(middle)) / 2.0;
+}
+
+double mean(const QList<double> &values)
+{
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    return sum / values.size();
+}
+
+// Sample standard deviation, as Google Benchmark reports it
+double stddev(const QList<double> &values)
+{
+    if (values.size() < 2) {
+        return 0.0;
+    }
+    double average = mean(values);
+    double sum = 0.0;
+    for (double value : values) {
+        sum += (value - average) * (value - average);
+    }
+    return std::sqrt(sum / (values.size() - 1));
+}
+
+struct Batch {
+    qint64 realNs = 0;
+    qint64 cpuNs = 0;   // -1 where thread CPU time is unavailable
+    AllocationCounter::Counts allocated;
+};
+
+// Times iterations calls of op. With a setup, each call is preceded by an
+// untimed setup() and only the op calls are timed and counted.
+Batch runBatch(const std::function<void()> &op, const std::function<void()> &setup, qint64 iterations)
+{
+    Batch batch;
+    QElapsedTimer timer;
+    const qint64 calls = setup ? iterations : 1;
+    const qint64 perCall = setup ? 1 : iterations;
+    for (qint64 call = 0; call < calls; ++call) {
+        if (setup) {
+            setup();
+        }
+
+        AllocationScope allocations;
+        qint64 cpuStart = BenchHarness::threadCpuNs();
+        timer.start();
+        for (qint64 i = 0; i < perCall; ++i) {
+            op();
+        }
+        batch.realNs += timer.nsecsElapsed();
+        qint64 cpuEnd = BenchHarness::threadCpuNs();
+
+        AllocationCounter::Counts counts = allocations.counts();
+        batch.allocated.allocations += counts.allocations;
+        batch.allocated.bytes += counts.bytes;
+        batch.allocated.deallocations += counts.deallocations;
+        if (cpuStart < 0 || cpuEnd < 0 || batch.cpuNs < 0) {
+            batch.cpuNs = -1;
+        } else {
+            batch.cpuNs += cpuEnd - cpuStart;
+        }
+    }
+    return batch;
+}
+
+} // namespace
+
+BenchHarness::BenchHarness(const QString &suiteName, const QStringList &arguments)
+    : m_suiteName(suiteName)
+    , m_minTimeMs(200)
+    , m_repetitions(3)
+{
+    for (int i = 1; i < arguments.size(); ++i) {
+        const QString &arg = arguments.at(i);
+        bool hasValue = i + 1 < arguments.size();
+        if (arg == "--json" && hasValue) {
+            m_jsonPath = arguments.at(++i);
+        } else if (arg == "--filter" && hasValue) {
+            m_filter = arguments.at(++i);
+        } else if (arg == "--min-time-ms" && hasValue) {
+            m_minTimeMs = qMax(1, arguments.at(++i).toInt());
+        } else if (arg == "--repetitions" && hasValue) {
+            m_repetitions = qMax(1, arguments.at(++i).toInt());
+        }
+    }
+
+    printf("%s (%d threads)\n", qPrintable(m_suiteName), QThread::idealThreadCount());
+    printf("%-52s %12s %14s %14s %14s\n", "benchmark", "iterations", "median/op", "min/op", "cpu/op");
+}
+
+bool BenchHarness::matches(const QString &name) const
+{
+    return m_filter.isEmpty() || name.contains(m_filter);
+}
+
+void BenchHarness::run(const QString &name, const std::function<void()> &op)
+{
+    run(name, op, std::function<void()>());
+}
+
+void BenchHarness::run(const QString &name, const std::function<void()> &op, const std::function<void()> &setup)
+{
+    if (!matches(name)) {
+        return;
+    }
+
+    const qint64 targetNs = qint64(m_minTimeMs) * 1000000 / m_repetitions;
+
+    // Calibrate (and warm up) by doubling until one batch is long enough
+    qint64 iterations = 1;
+    for (;;) {
+        qint64 elapsed = runBatch(op, setup, iterations).realNs;
+        if (elapsed >= targetNs || iterations >= (qint64(1) << 30)) {
+            break;
+        }
+        iterations *= elapsed > 0 ? qBound<qint64>(2, targetNs / elapsed + 1, 16) : 16;
+    }
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.realNsPerOp.reserve(m_repetitions);
+    result.cpuNsPerOp.reserve(m_repetitions);
+    AllocationCounter::Counts allocated;
+    for (int rep = 0; rep < m_repetitions; ++rep) {
+        Batch batch = runBatch(op, setup, iterations);
+        result.realNsPerOp.append(double(batch.realNs) / iterations);
+        if (batch.cpuNs >= 0) {
+            result.cpuNsPerOp.append(double(batch.cpuNs) / iterations);
+        }
+        allocated.allocations += batch.allocated.allocations;
+        allocated.bytes += batch.allocated.bytes;
+        allocated.deallocations += batch.allocated.deallocations;
+    }
+    if (result.cpuNsPerOp.size() != result.realNsPerOp.size()) {
+        result.cpuNsPerOp.clear();
+    }
+    m_results.append(result);
+
+    printf("%-52s %12lld %14s %14s %14s\n", qPrintable(name), iterations,
+           qPrintable(formatNs(median(result.realNsPerOp))),
+           qPrintable(formatNs(*std::min_element(result.realNsPerOp.constBegin(), result.realNsPerOp.constEnd()))),
+           result.cpuNsPerOp.isEmpty() ? "-" : qPrintable(formatNs(median(result.cpuNsPerOp))));
+
+    if (AllocationCounter::isAvailable()) {
+        double ops = double(iterations) * m_repetitions;
+        addCounter("allocations_per_op", allocated.allocations / ops);
+        addCounter("bytes_per_op", allocated.bytes / ops);
+    }
+    fflush(stdout);
+}
+
+void BenchHarness::addCounter(const QString &name, double value)
+{
+    if (m_results.isEmpty()) {
+        return;
+    }
+    m_results.last().counters.append(qMakePair(name, value));
+    printf("%-52s %12s %14.1f\n", qPrintable("  " + name), "", value);
+}
+
+int BenchHarness::finish()
+{
+    if (m_jsonPath.isEmpty()) {
+        return 0;
+    }
+
+    QJsonObject context;
+    context["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    context["host_name"] = QSysInfo::machineHostName();
+    context["executable"] = m_suiteName;
+    context["num_cpus"] = QThread::idealThreadCount();
+    context["qt_version"] = QString(qVersion());
+#ifdef NDEBUG
+    context["library_build_type"] = "release";
+#else
+    context["library_build_type"] = "debug";
+#endif
+
+    QJsonArray benchmarks;
+    for (const Result &result : m_results) {
+        auto makeEntry = [&](const QString &name, const QString &runType) {
+            QJsonObject entry;
+            entry["name"] = name;
+            entry["run_name"] = result.name;
+            entry["run_type"] = runType;
+            entry["repetitions"] = m_repetitions;
+            entry["threads"] = 1;
+            entry["iterations"] = result.iterations;
+            entry["time_unit"] = "ns";
+            return entry;
+        };
+
+        // Counters are measured over all repetitions together
+        for (int rep = 0; rep < result.realNsPerOp.size(); ++rep) {
+            QJsonObject entry = makeEntry(result.name, "iteration");
+            entry["repetition_index"] = rep;
+            entry["real_time"] = result.realNsPerOp.at(rep);
+            if (!result.cpuNsPerOp.isEmpty()) {
+                entry["cpu_time"] = result.cpuNsPerOp.at(rep);
+            }
+            for (const auto &counter : result.counters) {
+                entry[counter.first] = counter.second;
+            }
+            benchmarks.append(entry);
+        }
+
+        if (result.realNsPerOp.size() < 2) {
+            continue;
+        }
+        const QList<QPair<QString, double (*)(const QList<double> &)>> aggregates = {
+            {"mean", &mean},
+            {"median", &median},
+            {"stddev", &stddev},
+        };
+        for (const auto &aggregate : aggregates) {
+            QJsonObject entry = makeEntry(result.name + "_" + aggregate.first, "aggregate");
+            entry["aggregate_name"] = aggregate.first;
+            entry["real_time"] = aggregate.second(result.realNsPerOp);
+            if (!result.cpuNsPerOp.isEmpty()) {
+                entry["cpu_time"] = aggregate.second(result.cpuNsPerOp);
+            }
+            for (const auto &counter : result.counters) {
+                entry[counter.first] = aggregate.first == "stddev" ? 0.0 : counter.second;
+            }
+            benchmarks.append(entry);
+        }
+    }
+
+    QJsonObject root;
+    root["context"] = context;
+    root["benchmarks"] = benchmarks;
+
+    QFile file(m_jsonPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        fprintf(stderr, "Cannot write %s\n", qPrintable(m_jsonPath));
+        return 1;
+    }
+    file.write(QJsonDocument(root).toJson());
+    printf("Results written to %s\n", qPrintable(m_jsonPath));
+    return 0;
+}
+
+qint64 BenchHarness::threadCpuNs()
+{
+#if defined(Q_OS_UNIX) && defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec now;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) == 0) {
+        return qint64(now.tv_sec) * 1000000000 + now.tv_nsec;
+    }
+#endif
+    return -1;
+}
+
+QString BenchHarness::formatNs(double ns)
+{
+    if (ns < 1e3) {
+        return QString("%1 ns").arg(ns, 0, 'f', 1);
+    } else if (ns < 1e6) {
+        return QString("%1 us").arg(ns / 1e3, 0, 'f', 2);
+    } else if (ns < 1e9) {
+        return QString("%1 ms").arg(ns / 1e6, 0, 'f', 2);
+    }
+    return QString("%1 s").arg(ns / 1e9, 0, 'f', 3);
+}
@@ -0,0 +1,77 @@
+#ifndef BENCHHARNESS_H
+#define BENCHHARNESS_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <functional>
+
+// Minimal benchmark runner shared by the benchmark executables. Each case
+// is calibrated so its repetitions together run for at least --min-time-ms,
+// and each repetition records wall time and the calling thread's CPU time
+// (work handed to other threads is not included, as in Google Benchmark).
+// Results print as a table and, with --json <file>, are written in Google
+// Benchmark's JSON layout (one entry per repetition plus mean, median and
+// stddev aggregates) so its tools (e.g. compare.py) can diff two runs.
+// When allocation counting is compiled in, every result also carries
+// allocations_per_op and bytes_per_op.
+//
+// Options: --json <file>  --filter <substring>  --min-time-ms <ms>
+//          --repetitions <n>
+class BenchHarness
+{
+public:
+    struct Result {
+        QString name;
+        qint64 iterations = 0;
+        QList<double> realNsPerOp;  // one per repetition, in run order
+        QList<double> cpuNsPerOp;   // empty where thread CPU time is unavailable
+        QList<QPair<QString, double>> counters;
+    };
+
+    BenchHarness(const QString &suiteName, const QStringList &arguments);
+
+    // Runs op repeatedly and records its time per call under name
+    void run(const QString &name, const std::function<void()> &op);
+
+    // Same, but calls setup before every op, outside the timed region. For
+    // cases that need fresh state per call; each op should take well over
+    // a microsecond so the per-call timer reads don't skew it.
+    void run(const QString &name, const std::function<void()> &op, const std::function<void()> &setup);
+
+    // Attaches a user counter (e.g. allocations per op) to the last result
+    void addCounter(const QString &name, double value);
+
+    bool matches(const QString &name) const;
+
+    // Writes --json output if requested; returns the process exit code
+    int finish();
+
+    static QString formatNs(double ns);
+
+    // CPU time consumed by the calling thread, or -1 if unavailable
+    static qint64 threadCpuNs();
+
+private:
+    QString m_suiteName;
+    QString m_jsonPath;
+    QString m_filter;
+    int m_minTimeMs;
+    int m_repetitions;
+    QList<Result> m_results;
+};
+
+// Keeps the optimizer from dropping a computed value
+template <typename T>
+inline void benchKeep(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const void *volatile sink;
+    sink = &value;
+#endif
+}
+
+#endif // BENCHHARNESS_H
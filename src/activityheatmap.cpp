@@ -0,0 +1,181 @@
+#include "activityheatmap.h"
+#include <QPainter>
+#include <QMouseEvent>
+#include <QToolTip>
+#include <QLocale>
+
+namespace {
+constexpr int kCellSize = 12;
+constexpr int kCellStep = 14;
+constexpr int kLeftMargin = 44;
+constexpr int kHeaderHeight = 18;
+constexpr int kBlockSpacing = 14;
+constexpr int kBlockHeight = kHeaderHeight + 7 * kCellStep + kBlockSpacing;
+
+// Monday on or before the date
+QDate weekStart(const QDate &date)
+{
+    return date.addDays(1 - date.dayOfWeek());
+}
+}
+
+ActivityHeatmap::ActivityHeatmap(const ActivityBitmap *activity, QWidget *parent)
+    : QWidget(parent)
+    , m_activity(activity)
+    , m_kinds(ActivityBitmap::BodyComposition | ActivityBitmap::Workout)
+{
+    setMouseTracking(true);
+    showLastYear();
+}
+
+void ActivityHeatmap::setKinds(ActivityBitmap::Kinds kinds)
+{
+    m_kinds = kinds;
+    update();
+}
+
+void ActivityHeatmap::showLastYear()
+{
+    QDate today = QDate::currentDate();
+    m_blocks = {{QString("Last 12 months"), weekStart(today.addDays(-364)), today}};
+    relayout();
+}
+
+void ActivityHeatmap::showAllYears()
+{
+    QDate first = m_activity->firstActiveDate(m_kinds);
+    QDate today = QDate::currentDate();
+    int firstYear = first.isValid() ? qMin(first.year(), today.year()) : today.year();
+
+    // Most recent year on top
+    m_blocks.clear();
+    for (int year = today.year(); year >= firstYear; --year) {
+        m_blocks.append({QString::number(year), QDate(year, 1, 1), QDate(year, 12, 31)});
+    }
+    relayout();
+}
+
+void ActivityHeatmap::relayout()
+{
+    updateGeometry();
+    resize(sizeHint());
+    update();
+}
+
+QSize ActivityHeatmap::sizeHint() const
+{
+    // 53 weeks plus a partial one at either end
+    return QSize(kLeftMargin + 54 * kCellStep + 8, m_blocks.size() * kBlockHeight);
+}
+
+QRect ActivityHeatmap::blockRect(int blockIndex) const
+{
+    return QRect(0, blockIndex * kBlockHeight, sizeHint().width(), kBlockHeight);
+}
+
+QRect ActivityHeatmap::cellRect(int blockIndex, const QDate &date) const
+{
+    const Block &block = m_blocks.at(blockIndex);
+    int column = static_cast<int>(weekStart(block.start).daysTo(date) / 7);
+    int row = date.dayOfWeek() - 1;
+    return QRect(kLeftMargin + column * kCellStep,
+                 blockIndex * kBlockHeight + kHeaderHeight + row * kCellStep,
+                 kCellSize, kCellSize);
+}
+
+QDate ActivityHeatmap::dateAt(const QPoint &position) const
+{
+    int blockIndex = position.y() / kBlockHeight;
+    if (blockIndex < 0 || blockIndex >= m_blocks.size() || position.x() < kLeftMargin) {
+        return QDate();
+    }
+
+    int y = position.y() - blockIndex * kBlockHeight - kHeaderHeight;
+    int column = (position.x() - kLeftMargin) / kCellStep;
+    int row = y / kCellStep;
+    if (y < 0 || row >= 7) {
+        return QDate();
+    }
+
+    const Block &block = m_blocks.at(blockIndex);
+    QDate date = weekStart(block.start).addDays(column * 7 + row);
+    return (date >= block.start && date <= block.end) ? date : QDate();
+}
+
+QColor ActivityHeatmap::cellColor(const QDate &date) const
+{
+    bool bodyComposition = m_kinds.testFlag(ActivityBitmap::BodyComposition)
+                           && m_activity->isActive(date, ActivityBitmap::BodyComposition);
+    bool workout = m_kinds.testFlag(ActivityBitmap::Workout)
+                   && m_activity->isActive(date, ActivityBitmap::Workout);
+
+    if (bodyComposition && workout) {
+        return QColor(33, 110, 57);    // Both logged
+    }
+    if (workout) {
+        return QColor(48, 161, 78);
+    }
+    if (bodyComposition) {
+        return QColor(155, 233, 168);
+    }
+    return QColor(235, 237, 240);
+}
+
+void ActivityHeatmap::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    QLocale locale;
+
+    for (int i = 0; i < m_blocks.size(); ++i) {
+        if (!blockRect(i).intersects(event->rect())) {
+            continue;
+        }
+        const Block &block = m_blocks.at(i);
+        int top = i * kBlockHeight;
+
+        // Block title and weekday labels
+        painter.setPen(QColor(80, 80, 80));
+        painter.drawText(QRect(0, top, kLeftMargin * 4, kHeaderHeight - 4), Qt::AlignLeft | Qt::AlignVCenter, block.title);
+        for (int row : {0, 2, 4}) {
+            painter.drawText(QRect(0, top + kHeaderHeight + row * kCellStep, kLeftMargin - 6, kCellSize),
+                             Qt::AlignRight | Qt::AlignVCenter, locale.dayName(row + 1, QLocale::ShortFormat));
+        }
+
+        // Month labels over the week that holds the 1st
+        for (QDate month(block.start.year(), block.start.month(), 1); month <= block.end; month = month.addMonths(1)) {
+            if (month < block.start) {
+                continue;
+            }
+            QRect cell = cellRect(i, month);
+            painter.drawText(QRect(cell.left(), top, kCellStep * 4, kHeaderHeight - 2), Qt::AlignLeft | Qt::AlignBottom,
+                             locale.monthName(month.month(), QLocale::ShortFormat));
+        }
+
+        painter.setPen(Qt::NoPen);
+        for (QDate date = block.start; date <= block.end; date = date.addDays(1)) {
+            painter.setBrush(cellColor(date));
+            painter.drawRoundedRect(cellRect(i, date), 2, 2);
+        }
+    }
+}
+
+void ActivityHeatmap::mouseMoveEvent(QMouseEvent *event)
+{
+    QDate date = dateAt(event->position().toPoint());
+    if (!date.isValid()) {
+        QToolTip::hideText();
+        return;
+    }
+
+    QStringList logged;
+    if (m_activity->isActive(date, ActivityBitmap::Workout)) {
+        logged.append("workout");
+    }
+    if (m_activity->isActive(date, ActivityBitmap::BodyComposition)) {
+        logged.append("body composition");
+    }
+    QString text = date.toString("ddd, MMM d, yyyy") + "\n"
+                 + (logged.isEmpty() ? QString("Nothing logged") : "Logged: " + logged.join(", "));
+    QToolTip::showText(event->globalPosition().toPoint(), text, this);
+}
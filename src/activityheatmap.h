@@ -0,0 +1,48 @@
+#ifndef ACTIVITYHEATMAP_H
+#define ACTIVITYHEATMAP_H
+
+#include <QWidget>
+#include <QDate>
+#include <QList>
+#include <QRect>
+#include "models/activitybitmap.h"
+
+// GitHub-style calendar of logged days: one column per week, one row per
+// weekday, one block per year (or a single rolling 12-month block). Every
+// cell is a bit lookup in the activity bitmap, so many years paint at once.
+class ActivityHeatmap : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit ActivityHeatmap(const ActivityBitmap *activity, QWidget *parent = nullptr);
+
+    void setKinds(ActivityBitmap::Kinds kinds);
+    void showLastYear();
+    void showAllYears();
+
+    QSize sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+
+private:
+    struct Block {
+        QString title;
+        QDate start;    // first day shown
+        QDate end;      // last day shown
+    };
+
+    QRect blockRect(int blockIndex) const;
+    QRect cellRect(int blockIndex, const QDate &date) const;
+    QDate dateAt(const QPoint &position) const;
+    QColor cellColor(const QDate &date) const;
+    void relayout();
+
+    const ActivityBitmap *m_activity;
+    ActivityBitmap::Kinds m_kinds;
+    QList<Block> m_blocks;
+};
+
+#endif // ACTIVITYHEATMAP_H
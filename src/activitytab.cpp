@@ -0,0 +1,113 @@
+#include "activitytab.h"
+#include "activityheatmap.h"
+#include "utils/trace.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QScrollArea>
+
+ActivityTab::ActivityTab(DataManager *dataManager, QWidget *parent)
+    : QWidget(parent)
+    , m_dataManager(dataManager)
+    , m_kindsCombo(nullptr)
+    , m_rangeCombo(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_heatmap(nullptr)
+{
+    setupUI();
+}
+
+void ActivityTab::setupUI()
+{
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+
+    // Controls layout
+    QHBoxLayout *controlsLayout = new QHBoxLayout();
+
+    QLabel *kindsLabel = new QLabel("Show:");
+    m_kindsCombo = new QComboBox();
+    m_kindsCombo->addItem("Any activity", int(ActivityBitmap::BodyComposition) | int(ActivityBitmap::Workout));
+    m_kindsCombo->addItem("Workouts", int(ActivityBitmap::Workout));
+    m_kindsCombo->addItem("Body composition", int(ActivityBitmap::BodyComposition));
+
+    QLabel *rangeLabel = new QLabel("Period:");
+    m_rangeCombo = new QComboBox();
+    m_rangeCombo->addItem("Last 12 months");
+    m_rangeCombo->addItem("All years");
+
+    controlsLayout->addWidget(kindsLabel);
+    controlsLayout->addWidget(m_kindsCombo);
+    controlsLayout->addWidget(rangeLabel);
+    controlsLayout->addWidget(m_rangeCombo);
+    controlsLayout->addStretch();
+
+    m_summaryLabel = new QLabel();
+    m_summaryLabel->setStyleSheet("QLabel { color: #666; }");
+
+    m_heatmap = new ActivityHeatmap(&m_dataManager->getActivity());
+    QScrollArea *scrollArea = new QScrollArea();
+    scrollArea->setWidget(m_heatmap);
+    scrollArea->setFrameShape(QFrame::NoFrame);
+
+    mainLayout->addLayout(controlsLayout);
+    mainLayout->addWidget(m_summaryLabel);
+    mainLayout->addWidget(scrollArea);
+
+    // Connect signals
+    connect(m_kindsCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &ActivityTab::onKindsChanged);
+    connect(m_rangeCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &ActivityTab::onRangeChanged);
+}
+
+ActivityBitmap::Kinds ActivityTab::selectedKinds() const
+{
+    return ActivityBitmap::Kinds(QFlag(m_kindsCombo->currentData().toInt()));
+}
+
+void ActivityTab::refresh()
+{
+    TRACE_SCOPE("ActivityTab::refresh");
+    onRangeChanged();
+}
+
+void ActivityTab::onKindsChanged()
+{
+    m_heatmap->setKinds(selectedKinds());
+    refresh();
+}
+
+void ActivityTab::onRangeChanged()
+{
+    if (m_rangeCombo->currentIndex() == 0) {
+        m_heatmap->showLastYear();
+    } else {
+        m_heatmap->showAllYears();
+    }
+    updateSummary();
+}
+
+void ActivityTab::updateSummary()
+{
+    const ActivityBitmap &activity = m_dataManager->getActivity();
+    ActivityBitmap::Kinds kinds = selectedKinds();
+    QDate today = QDate::currentDate();
+
+    ActivityBitmap::Streak current = activity.currentStreak(today, kinds);
+    ActivityBitmap::Streak longest = activity.longestStreak(kinds);
+    int thisMonth = activity.count(QDate(today.year(), today.month(), 1), today, kinds);
+    int thisYear = activity.count(QDate(today.year(), 1, 1), today, kinds);
+    int lastYear = activity.count(today.addDays(-364), today, kinds);
+
+    QString text = QString("Current streak: %1 day%2").arg(current.length).arg(current.length == 1 ? "" : "s");
+    if (longest.length > 0) {
+        text += QString("  |  Longest: %1 days (%2 - %3)")
+                    .arg(longest.length)
+                    .arg(longest.start.toString("MMM d, yyyy"))
+                    .arg(longest.end.toString("MMM d, yyyy"));
+    }
+    text += QString("  |  This month: %1  |  This year: %2  |  Last 12 months: %3")
+                .arg(thisMonth)
+                .arg(thisYear)
+                .arg(lastYear);
+    m_summaryLabel->setText(text);
+}
@@ -0,0 +1,40 @@
+#ifndef ACTIVITYTAB_H
+#define ACTIVITYTAB_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QComboBox>
+#include "models/datamanager.h"
+
+class ActivityHeatmap;
+
+// Calendar heatmap of logged days with current and longest streaks
+class ActivityTab : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit ActivityTab(DataManager *dataManager, QWidget *parent = nullptr);
+
+public slots:
+    void refresh();
+
+private slots:
+    void onKindsChanged();
+    void onRangeChanged();
+
+private:
+    void setupUI();
+    ActivityBitmap::Kinds selectedKinds() const;
+    void updateSummary();
+
+    DataManager *m_dataManager;
+
+    // UI Components
+    QComboBox *m_kindsCombo;
+    QComboBox *m_rangeCombo;
+    QLabel *m_summaryLabel;
+    ActivityHeatmap *m_heatmap;
+};
+
+#endif // ACTIVITYTAB_H
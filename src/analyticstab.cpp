@@ -4,20 +4,39 @@
 #include <QLabel>
 #include <QDate>
 #include <QDebug>
-#include <cstdio>
+#include <QtMath>
+#include <QSignalBlocker>
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QAreaSeries>
 #include <QtCharts/QChart>
 #include <QtCharts/QChartView>
 #include <QtCharts/QDateTimeAxis>
 #include <QtCharts/QValueAxis>
+#include "seriesupdater.h"
+#include "utils/logging.h"
+#include "utils/latencyhistogram.h"
+#include "utils/trace.h"
+#include "strengthtab.h"
+#include "volumetab.h"
+#include "trainingloadtab.h"
+#include "activitytab.h"
 
 AnalyticsTab::AnalyticsTab(DataManager *dataManager, QWidget *parent)
     : QWidget(parent)
     , m_dataManager(dataManager)
     , m_chartTabs(nullptr)
     , m_timeRangeCombo(nullptr)
+    , m_trendCombo(nullptr)
     , m_refreshButton(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_strengthTab(nullptr)
+    , m_goalCombo(nullptr)
+    , m_goalSlider(nullptr)
+    , m_goalLabel(nullptr)
+    , m_goalTimer(nullptr)
+    , m_volumeTab(nullptr)
+    , m_trainingLoadTab(nullptr)
+    , m_activityTab(nullptr)
     , m_weightChartView(nullptr)
     , m_bmiChartView(nullptr)
     , m_bodyFatChartView(nullptr)
@@ -30,6 +49,12 @@ AnalyticsTab::AnalyticsTab(DataManager *dataManager, QWidget *parent)
     , m_bmiSeries(nullptr)
     , m_bodyFatSeries(nullptr)
     , m_waistSeries(nullptr)
+    , m_weightTrendSeries(nullptr)
+    , m_bodyFatTrendSeries(nullptr)
+    , m_weightGoalBand(nullptr)
+    , m_weightGoalMedian(nullptr)
+    , m_bodyFatGoalBand(nullptr)
+    , m_bodyFatGoalMedian(nullptr)
     , m_underweightArea(nullptr)
     , m_normalArea(nullptr)
     , m_overweightArea(nullptr)
@@ -40,25 +65,6 @@ AnalyticsTab::AnalyticsTab(DataManager *dataManager, QWidget *parent)
     // Connect to data manager signals
     connect(m_dataManager, &DataManager::dataChanged, this, &AnalyticsTab::onDataChanged);
     
-    // Debug: Test data loading using same method as body composition tab
-    printf("AnalyticsTab constructor: Testing individual date loading like body composition tab...\n");
-    QList<QDate> allDates = m_dataManager->getBodyCompositionDates();
-    printf("Found %d dates with body composition data\n", allDates.size());
-    
-    for (int i = 0; i < qMin(3, allDates.size()); ++i) {
-        QDate date = allDates[i];
-        if (m_dataManager->hasBodyComposition(date)) {
-            BodyComposition comp = m_dataManager->loadBodyComposition(date);
-            printf("  Date %s: Valid:%d Weight:%.1f BMI:%.1f\n", 
-                   date.toString().toLocal8Bit().data(),
-                   comp.date().isValid() ? 1 : 0, comp.weight(), comp.bmi());
-        }
-    }
-    
-    // Also test our aggregation methods
-    QList<BodyComposition> testData = m_dataManager->getAllBodyCompositionSorted();
-    printf("Our getAllBodyCompositionSorted method returns %d entries\n", testData.size());
-    
     // Initial chart update
     refreshCharts();
 }
@@ -79,13 +85,55 @@ void AnalyticsTab::setupUI()
     m_timeRangeCombo->addItem("All Time", -1);
     m_timeRangeCombo->setCurrentIndex(2); // Default to 6 months
     
+    QLabel *trendLabel = new QLabel("Trend:");
+    m_trendCombo = new QComboBox();
+    m_trendCombo->addItem("Off", -1);
+    m_trendCombo->addItem("Moving Average (EWMA)", TrendFilter::EWMA);
+    m_trendCombo->addItem("Kalman Filter", TrendFilter::Kalman);
+    m_trendCombo->setCurrentIndex(1); // Default to EWMA
+    
     m_refreshButton = new QPushButton("Refresh");
     
+    m_summaryLabel = new QLabel();
+    m_summaryLabel->setStyleSheet("QLabel { color: #666; }");
+    
     controlsLayout->addWidget(timeRangeLabel);
     controlsLayout->addWidget(m_timeRangeCombo);
+    controlsLayout->addWidget(trendLabel);
+    controlsLayout->addWidget(m_trendCombo);
+    controlsLayout->addSpacing(16);
+    controlsLayout->addWidget(m_summaryLabel);
     controlsLayout->addStretch();
     controlsLayout->addWidget(m_refreshButton);
     
+    // Goal projection controls
+    QHBoxLayout *goalLayout = new QHBoxLayout();
+    
+    QLabel *goalTitleLabel = new QLabel("Goal:");
+    m_goalCombo = new QComboBox();
+    m_goalCombo->addItem("Off", -1);
+    m_goalCombo->addItem("Weight", BodyCompositionIndex::Weight);
+    m_goalCombo->addItem("Body Fat", BodyCompositionIndex::BodyFat);
+    
+    // Slider works in tenths so both lbs and % move in 0.1 steps
+    m_goalSlider = new QSlider(Qt::Horizontal);
+    m_goalSlider->setMinimumWidth(200);
+    m_goalSlider->setEnabled(false);
+    
+    m_goalLabel = new QLabel();
+    m_goalLabel->setStyleSheet("QLabel { color: #666; }");
+    
+    // Coalesce slider moves; each projection simulates tens of thousands of paths
+    m_goalTimer = new QTimer(this);
+    m_goalTimer->setSingleShot(true);
+    m_goalTimer->setInterval(15);
+    
+    goalLayout->addWidget(goalTitleLabel);
+    goalLayout->addWidget(m_goalCombo);
+    goalLayout->addWidget(m_goalSlider);
+    goalLayout->addWidget(m_goalLabel);
+    goalLayout->addStretch();
+    
     // Charts tab widget
     m_chartTabs = new QTabWidget();
     
@@ -95,22 +143,43 @@ void AnalyticsTab::setupUI()
     setupBodyFatChart();
     setupWaistChart();
     
+    m_strengthTab = new StrengthTab(m_dataManager);
+    m_chartTabs->addTab(m_strengthTab, "Strength");
+    m_volumeTab = new VolumeTab(m_dataManager);
+    m_chartTabs->addTab(m_volumeTab, "Volume");
+    m_trainingLoadTab = new TrainingLoadTab(m_dataManager);
+    m_chartTabs->addTab(m_trainingLoadTab, "Training Load");
+    m_activityTab = new ActivityTab(m_dataManager);
+    m_chartTabs->addTab(m_activityTab, "Activity");
+    
     mainLayout->addLayout(controlsLayout);
+    mainLayout->addLayout(goalLayout);
     mainLayout->addWidget(m_chartTabs);
     
     // Connect signals
     connect(m_timeRangeCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &AnalyticsTab::onTimeRangeChanged);
+    connect(m_trendCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &AnalyticsTab::onTrendMethodChanged);
     connect(m_refreshButton, &QPushButton::clicked, this, &AnalyticsTab::refreshCharts);
+    connect(m_goalCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &AnalyticsTab::onGoalMetricChanged);
+    connect(m_goalSlider, &QSlider::valueChanged, m_goalTimer, QOverload<>::of(&QTimer::start));
+    connect(m_goalTimer, &QTimer::timeout, this, &AnalyticsTab::updateGoalProjection);
 }
 
 void AnalyticsTab::setupWeightChart()
 {
     m_weightChart = new QChart();
     m_weightSeries = new QLineSeries();
+    m_weightSeries->setName("Weight");
+    m_weightTrendSeries = new QLineSeries();
+    m_weightTrendSeries->setName("Trend");
+    m_weightTrendSeries->setPen(QPen(QColor(220, 53, 69), 2, Qt::DashLine));
     
     setupChartAppearance(m_weightChart, "Weight Trend");
     m_weightChart->addSeries(m_weightSeries);
+    m_weightChart->addSeries(m_weightTrendSeries);
     
     // Manually set up axes following Qt documentation exactly
     QDateTimeAxis *axisX = new QDateTimeAxis();
@@ -119,13 +188,15 @@ void AnalyticsTab::setupWeightChart()
     axisX->setTitleText("Date");
     m_weightChart->addAxis(axisX, Qt::AlignBottom);
     m_weightSeries->attachAxis(axisX);
+    m_weightTrendSeries->attachAxis(axisX);
     
     QValueAxis *axisY = new QValueAxis();
     axisY->setTitleText("Weight (lbs)");
     m_weightChart->addAxis(axisY, Qt::AlignLeft);
     m_weightSeries->attachAxis(axisY);
+    m_weightTrendSeries->attachAxis(axisY);
     
-    printf("setupWeightChart: Axes created and attached\n");
+    setupGoalSeries(m_weightChart, m_weightGoalBand, m_weightGoalMedian);
     
     m_weightChartView = new QChartView(m_weightChart);
     m_weightChartView->setRenderHint(QPainter::Antialiasing);
@@ -206,6 +277,10 @@ void AnalyticsTab::setupBodyFatChart()
 {
     m_bodyFatChart = new QChart();
     m_bodyFatSeries = new QLineSeries();
+    m_bodyFatSeries->setName("Body Fat");
+    m_bodyFatTrendSeries = new QLineSeries();
+    m_bodyFatTrendSeries->setName("Trend");
+    m_bodyFatTrendSeries->setPen(QPen(QColor(220, 53, 69), 2, Qt::DashLine));
     
     setupChartAppearance(m_bodyFatChart, "Body Fat Percentage");
     
@@ -247,6 +322,7 @@ void AnalyticsTab::setupBodyFatChart()
     m_bodyFatChart->addSeries(m_bodyFatAverageArea);
     m_bodyFatChart->addSeries(m_bodyFatObeseArea);
     m_bodyFatChart->addSeries(m_bodyFatSeries);
+    m_bodyFatChart->addSeries(m_bodyFatTrendSeries);
     
     // Setup axes with manual configuration like weight chart
     QDateTimeAxis *axisX = new QDateTimeAxis();
@@ -273,6 +349,10 @@ void AnalyticsTab::setupBodyFatChart()
     m_bodyFatObeseArea->attachAxis(axisY);
     m_bodyFatSeries->attachAxis(axisX);
     m_bodyFatSeries->attachAxis(axisY);
+    m_bodyFatTrendSeries->attachAxis(axisX);
+    m_bodyFatTrendSeries->attachAxis(axisY);
+    
+    setupGoalSeries(m_bodyFatChart, m_bodyFatGoalBand, m_bodyFatGoalMedian);
     
     m_bodyFatChartView = new QChartView(m_bodyFatChart);
     m_bodyFatChartView->setRenderHint(QPainter::Antialiasing);
@@ -317,28 +397,93 @@ void AnalyticsTab::setupChartAppearance(QChart *chart, const QString &title)
 
 QList<BodyComposition> AnalyticsTab::getFilteredData()
 {
-    int days = m_timeRangeCombo->currentData().toInt();
+    QDate startDate, endDate;
+    getFilterDateRange(startDate, endDate);
     
     QList<BodyComposition> data;
-    if (days == -1) {
+    if (!startDate.isValid()) {
         // All time
         data = m_dataManager->getAllBodyCompositionSorted();
     } else {
         // Specific time range
-        QDate endDate = QDate::currentDate();
-        QDate startDate = endDate.addDays(-days);
         data = m_dataManager->getBodyCompositionRange(startDate, endDate);
     }
     
-    qDebug() << "getFilteredData: Got" << data.size() << "body composition entries";
-    for (const BodyComposition &composition : data) {
-        qDebug() << "  Date:" << composition.date().toString() << "Weight:" << composition.weight() 
-                 << "BMI:" << composition.bmi() << "Valid:" << composition.date().isValid();
-    }
+    qCDebug(lcAnalytics) << "getFilteredData:" << data.size() << "entries" << startDate << endDate;
     
     return data;
 }
 
+void AnalyticsTab::getFilterDateRange(QDate &startDate, QDate &endDate) const
+{
+    int days = m_timeRangeCombo->currentData().toInt();
+    if (days == -1) {
+        // "All Time" leaves both ends open
+        startDate = QDate();
+        endDate = QDate();
+        return;
+    }
+    
+    endDate = QDate::currentDate();
+    startDate = endDate.addDays(-days);
+}
+
+void AnalyticsTab::updateSummary()
+{
+    if (!m_summaryLabel) return;
+    
+    QDate startDate, endDate;
+    getFilterDateRange(startDate, endDate);
+    BodyCompositionIndex::RangeStats weights =
+        m_dataManager->getBodyCompositionStats(BodyCompositionIndex::Weight, startDate, endDate);
+    BodyCompositionIndex::RangeStats bodyFat =
+        m_dataManager->getBodyCompositionStats(BodyCompositionIndex::BodyFat, startDate, endDate);
+    
+    if (weights.isEmpty()) {
+        m_summaryLabel->setText("No entries in this period");
+        return;
+    }
+    
+    QString text = QString("Avg weight: %1 lbs (±%2, %3-%4) over %5 entries")
+                       .arg(weights.mean, 0, 'f', 1)
+                       .arg(qSqrt(weights.variance), 0, 'f', 1)
+                       .arg(weights.min, 0, 'f', 1)
+                       .arg(weights.max, 0, 'f', 1)
+                       .arg(weights.count);
+    if (!bodyFat.isEmpty()) {
+        text += QString("  |  Avg body fat: %1%").arg(bodyFat.mean, 0, 'f', 1);
+    }
+    m_summaryLabel->setText(text);
+}
+
+QPair<double, double> AnalyticsTab::weightAxisRange() const
+{
+    QDate startDate, endDate;
+    getFilterDateRange(startDate, endDate);
+    BodyCompositionIndex::RangeStats weights =
+        m_dataManager->getBodyCompositionStats(BodyCompositionIndex::Weight, startDate, endDate);
+    if (weights.isEmpty()) {
+        return QPair<double, double>(150, 250); // Default range
+    }
+    
+    // Add padding to the range
+    double padding = qMax(5.0, (weights.max - weights.min) * 0.1);
+    return QPair<double, double>(weights.min - padding, weights.max + padding);
+}
+
+QDate AnalyticsTab::dateAxisEnd() const
+{
+    QDate startDate, endDate;
+    getFilterDateRange(startDate, endDate);
+    if (endDate.isValid()) {
+        return endDate;
+    }
+    
+    // "All Time" ends at the last entry, as in setDateAxisRange
+    QDate lastDate = m_dataManager->getDataDateRange().second;
+    return lastDate.isValid() ? lastDate : QDate::currentDate();
+}
+
 void AnalyticsTab::setDateAxisRange(QDateTimeAxis* dateAxis, const QList<BodyComposition>& data)
 {
     if (!dateAxis) return;
@@ -378,94 +523,87 @@ void AnalyticsTab::onTimeRangeChanged()
     refreshCharts();
 }
 
+void AnalyticsTab::onTrendMethodChanged()
+{
+    updateTrendSeries(m_weightTrendSeries, BodyCompositionIndex::Weight);
+    updateTrendSeries(m_bodyFatTrendSeries, BodyCompositionIndex::BodyFat);
+}
+
 void AnalyticsTab::refreshCharts()
 {
-    printf("refreshCharts called\n");
+    TRACE_SCOPE("AnalyticsTab::refreshCharts");
+    LatencyScope latency(Latency::ChartRefresh);
+    qCDebug(lcAnalytics) << "refreshCharts";
     updateWeightChart();
     updateBMIChart();
     updateBodyFatChart();
     updateWaistChart();
+    updateSummary();
+    
+    QDate startDate, endDate;
+    getFilterDateRange(startDate, endDate);
+    m_strengthTab->setDateRange(startDate, endDate);
+    m_strengthTab->refresh();
+    m_volumeTab->setDateRange(startDate, endDate);
+    m_volumeTab->refresh();
+    m_trainingLoadTab->setDateRange(startDate, endDate);
+    m_trainingLoadTab->refresh();
+    m_activityTab->refresh();
+    
+    // Charts just reset their axes; put the projection back on top
+    updateGoalProjection();
 }
 
 void AnalyticsTab::updateWeightChart()
 {
+    TRACE_SCOPE("AnalyticsTab::updateWeightChart");
     if (!m_weightSeries) {
-        printf("updateWeightChart: m_weightSeries is null\n");
         return;
     }
     
-    m_weightSeries->clear();
-    
     QList<BodyComposition> data = getFilteredData();
-    printf("updateWeightChart: got %d data points\n", data.size());
+    qCDebug(lcAnalytics) << "updateWeightChart:" << data.size() << "entries";
     if (data.isEmpty()) {
-        printf("updateWeightChart: no data, returning\n");
+        SeriesUpdater::apply(m_weightSeries, QList<QPointF>());
+        updateTrendSeries(m_weightTrendSeries, BodyCompositionIndex::Weight);
         return;
     }
     
-    int pointsAdded = 0;
+    QList<QPointF> points;
+    points.reserve(data.size());
     for (const BodyComposition &composition : data) {
         if (composition.weight() > 0) {
             QDate date = composition.date();
             if (!date.isValid()) {
-                printf("updateWeightChart: Invalid date found, skipping\n");
                 continue;
             }
             qint64 timestamp = date.startOfDay().toMSecsSinceEpoch();
-            
-            // Debug: verify our timestamp calculation
-            QDateTime backToDateTime = QDateTime::fromMSecsSinceEpoch(timestamp);
-            printf("updateWeightChart: Original date: %s\n", date.toString().toLocal8Bit().data());
-            printf("updateWeightChart: Timestamp: %lld\n", timestamp);
-            printf("updateWeightChart: Back to QDateTime: %s\n", backToDateTime.toString().toLocal8Bit().data());
-            
-            m_weightSeries->append(timestamp, composition.weight());
-            pointsAdded++;
-            printf("updateWeightChart: Added point - Weight: %.1f\n", composition.weight());
+            points.append(QPointF(timestamp, composition.weight()));
+            qCDebug(lcAnalytics) << "  weight point" << date << composition.weight();
         }
     }
-    printf("updateWeightChart: Total points added to series: %d\n", pointsAdded);
-    printf("updateWeightChart: Series now has %d points\n", m_weightSeries->count());
+    int pointsAdded = points.size();
+    SeriesUpdater::apply(m_weightSeries, points);
+    updateTrendSeries(m_weightTrendSeries, BodyCompositionIndex::Weight);
+    qCDebug(lcAnalytics) << "updateWeightChart:" << pointsAdded << "points";
     
     // Since we have manually set up axes, just ensure they have proper ranges
     if (m_weightChart && pointsAdded > 0) {
         QList<QAbstractAxis*> axesX = m_weightChart->axes(Qt::Horizontal);
         QList<QAbstractAxis*> axesY = m_weightChart->axes(Qt::Vertical);
         
-        printf("updateWeightChart: Chart has %d horizontal axes and %d vertical axes\n", 
-               axesX.size(), axesY.size());
-               
         // Set axis ranges based on requested time window
         if (!axesX.isEmpty() && !axesY.isEmpty()) {
-            printf("updateWeightChart: Setting ranges based on requested time window\n");
-            
             // Set the datetime axis range using helper function
             if (QDateTimeAxis* dateAxis = qobject_cast<QDateTimeAxis*>(axesX.first())) {
                 setDateAxisRange(dateAxis, data);
             }
             
-            // Calculate weight range from available data (with reasonable defaults)
+            // Weight range for the selected window comes straight from the aggregate index
             if (QValueAxis* valueAxis = qobject_cast<QValueAxis*>(axesY.first())) {
-                if (!data.isEmpty()) {
-                    double minWeight = 999, maxWeight = 0;
-                    for (const BodyComposition &comp : data) {
-                        if (comp.weight() > 0) {
-                            minWeight = qMin(minWeight, comp.weight());
-                            maxWeight = qMax(maxWeight, comp.weight());
-                        }
-                    }
-                    if (minWeight < 999) {
-                        // Add padding to the range
-                        double padding = qMax(5.0, (maxWeight - minWeight) * 0.1);
-                        valueAxis->setRange(minWeight - padding, maxWeight + padding);
-                        printf("updateWeightChart: Set weight axis range %.1f-%.1f lbs\n", 
-                               minWeight - padding, maxWeight + padding);
-                    } else {
-                        valueAxis->setRange(150, 250); // Default range
-                    }
-                } else {
-                    valueAxis->setRange(150, 250); // Default range when no data
-                }
+                QPair<double, double> range = weightAxisRange();
+                valueAxis->setRange(range.first, range.second);
+                qCDebug(lcAnalytics) << "updateWeightChart: weight axis" << range.first << "-" << range.second;
             }
         }
     }
@@ -473,71 +611,29 @@ void AnalyticsTab::updateWeightChart()
 
 void AnalyticsTab::updateBMIChart()
 {
+    TRACE_SCOPE("AnalyticsTab::updateBMIChart");
     if (!m_bmiSeries) return;
     
-    m_bmiSeries->clear();
-    
     QList<BodyComposition> data = getFilteredData();
     if (data.isEmpty()) {
+        SeriesUpdater::apply(m_bmiSeries, QList<QPointF>());
         return;
     }
     
-    printf("updateBMIChart: got %d data points\n", data.size());
+    qCDebug(lcAnalytics) << "updateBMIChart:" << data.size() << "entries";
     
     // Update BMI category background areas
-    if (!data.isEmpty()) {
-        qint64 startTime = data.first().date().startOfDay().toMSecsSinceEpoch();
-        qint64 endTime = data.last().date().startOfDay().toMSecsSinceEpoch();
-        
-        // Clear and recreate area series
-        auto underweightUpper = qobject_cast<QLineSeries*>(m_underweightArea->upperSeries());
-        auto underweightLower = qobject_cast<QLineSeries*>(m_underweightArea->lowerSeries());
-        auto normalUpper = qobject_cast<QLineSeries*>(m_normalArea->upperSeries());
-        auto normalLower = qobject_cast<QLineSeries*>(m_normalArea->lowerSeries());
-        auto overweightUpper = qobject_cast<QLineSeries*>(m_overweightArea->upperSeries());
-        auto overweightLower = qobject_cast<QLineSeries*>(m_overweightArea->lowerSeries());
-        auto obeseUpper = qobject_cast<QLineSeries*>(m_obeseArea->upperSeries());
-        auto obeseLower = qobject_cast<QLineSeries*>(m_obeseArea->lowerSeries());
-        
-        if (underweightUpper && underweightLower) {
-            underweightUpper->clear();
-            underweightLower->clear();
-            underweightUpper->append(startTime, 18.5);
-            underweightUpper->append(endTime, 18.5);
-            underweightLower->append(startTime, 15);
-            underweightLower->append(endTime, 15);
-        }
-        
-        if (normalUpper && normalLower) {
-            normalUpper->clear();
-            normalLower->clear();
-            normalUpper->append(startTime, 24.9);
-            normalUpper->append(endTime, 24.9);
-            normalLower->append(startTime, 18.5);
-            normalLower->append(endTime, 18.5);
-        }
-        
-        if (overweightUpper && overweightLower) {
-            overweightUpper->clear();
-            overweightLower->clear();
-            overweightUpper->append(startTime, 29.9);
-            overweightUpper->append(endTime, 29.9);
-            overweightLower->append(startTime, 25.0);
-            overweightLower->append(endTime, 25.0);
-        }
-        
-        if (obeseUpper && obeseLower) {
-            obeseUpper->clear();
-            obeseLower->clear();
-            obeseUpper->append(startTime, 40);
-            obeseUpper->append(endTime, 40);
-            obeseLower->append(startTime, 30.0);
-            obeseLower->append(endTime, 30.0);
-        }
-    }
+    qint64 startTime = data.first().date().startOfDay().toMSecsSinceEpoch();
+    qint64 endTime = data.last().date().startOfDay().toMSecsSinceEpoch();
+    
+    updateCategoryBand(m_underweightArea, startTime, endTime, 15, 18.5);
+    updateCategoryBand(m_normalArea, startTime, endTime, 18.5, 24.9);
+    updateCategoryBand(m_overweightArea, startTime, endTime, 25.0, 29.9);
+    updateCategoryBand(m_obeseArea, startTime, endTime, 30.0, 40);
     
     // Add BMI data points
-    int pointsAdded = 0;
+    QList<QPointF> points;
+    points.reserve(data.size());
     for (const BodyComposition &composition : data) {
         if (composition.bmi() > 0) {
             QDate date = composition.date();
@@ -545,12 +641,13 @@ void AnalyticsTab::updateBMIChart()
                 continue;
             }
             qint64 timestamp = date.startOfDay().toMSecsSinceEpoch();
-            m_bmiSeries->append(timestamp, composition.bmi());
-            pointsAdded++;
+            points.append(QPointF(timestamp, composition.bmi()));
         }
     }
+    int pointsAdded = points.size();
+    SeriesUpdater::apply(m_bmiSeries, points);
     
-    printf("updateBMIChart: Added %d points to series\n", pointsAdded);
+    qCDebug(lcAnalytics) << "updateBMIChart:" << pointsAdded << "points";
     
     // Dynamically set axis ranges based on filtered data
     if (m_bmiChart && pointsAdded > 0 && !data.isEmpty()) {
@@ -574,16 +671,18 @@ void AnalyticsTab::updateBMIChart()
 
 void AnalyticsTab::updateBodyFatChart()
 {
+    TRACE_SCOPE("AnalyticsTab::updateBodyFatChart");
     if (!m_bodyFatSeries) return;
     
-    m_bodyFatSeries->clear();
-    
     QList<BodyComposition> data = getFilteredData();
     if (data.isEmpty()) {
+        SeriesUpdater::apply(m_bodyFatSeries, QList<QPointF>());
+        updateTrendSeries(m_bodyFatTrendSeries, BodyCompositionIndex::BodyFat);
         return;
     }
     
-    int pointsAdded = 0;
+    QList<QPointF> points;
+    points.reserve(data.size());
     for (const BodyComposition &composition : data) {
         if (composition.bodyFatPercentage() > 0) {
             QDate date = composition.date();
@@ -591,97 +690,40 @@ void AnalyticsTab::updateBodyFatChart()
                 continue;
             }
             qint64 timestamp = date.startOfDay().toMSecsSinceEpoch();
-            m_bodyFatSeries->append(timestamp, composition.bodyFatPercentage());
-            pointsAdded++;
+            points.append(QPointF(timestamp, composition.bodyFatPercentage()));
         }
     }
+    SeriesUpdater::apply(m_bodyFatSeries, points);
+    updateTrendSeries(m_bodyFatTrendSeries, BodyCompositionIndex::BodyFat);
     
-    printf("updateBodyFatChart: Added %d points to series\n", pointsAdded);
+    qCDebug(lcAnalytics) << "updateBodyFatChart:" << points.size() << "points";
     
     // Update body fat category background areas
-    if (!data.isEmpty()) {
-        // Get the time range for this chart update
-        int days = m_timeRangeCombo->currentData().toInt();
-        QDate endDate = QDate::currentDate();
-        QDate startDate;
-        qint64 startTime, endTime;
-        
-        if (days == -1) {
-            // Use data range for "All Time"  
-            startTime = data.first().date().startOfDay().toMSecsSinceEpoch();
-            endTime = data.last().date().startOfDay().toMSecsSinceEpoch();
-        } else {
-            // Use requested time window
-            startDate = endDate.addDays(-days);
-            startTime = startDate.startOfDay().toMSecsSinceEpoch();
-            endTime = endDate.startOfDay().toMSecsSinceEpoch();
-        }
-        
-        // Clear and recreate body fat area series
-        auto essentialUpper = qobject_cast<QLineSeries*>(m_bodyFatEssentialArea->upperSeries());
-        auto essentialLower = qobject_cast<QLineSeries*>(m_bodyFatEssentialArea->lowerSeries());
-        auto athleticUpper = qobject_cast<QLineSeries*>(m_bodyFatAthleticArea->upperSeries());
-        auto athleticLower = qobject_cast<QLineSeries*>(m_bodyFatAthleticArea->lowerSeries());
-        auto fitnessUpper = qobject_cast<QLineSeries*>(m_bodyFatFitnessArea->upperSeries());
-        auto fitnessLower = qobject_cast<QLineSeries*>(m_bodyFatFitnessArea->lowerSeries());
-        auto averageUpper = qobject_cast<QLineSeries*>(m_bodyFatAverageArea->upperSeries());
-        auto averageLower = qobject_cast<QLineSeries*>(m_bodyFatAverageArea->lowerSeries());
-        auto obeseUpper = qobject_cast<QLineSeries*>(m_bodyFatObeseArea->upperSeries());
-        auto obeseLower = qobject_cast<QLineSeries*>(m_bodyFatObeseArea->lowerSeries());
-        
-        // Essential fat (2-5%)
-        if (essentialUpper && essentialLower) {
-            essentialUpper->clear();
-            essentialLower->clear();
-            essentialUpper->append(startTime, 5.0);
-            essentialUpper->append(endTime, 5.0);
-            essentialLower->append(startTime, 2.0);
-            essentialLower->append(endTime, 2.0);
-        }
-        
-        // Athletic (6-13%)
-        if (athleticUpper && athleticLower) {
-            athleticUpper->clear();
-            athleticLower->clear();
-            athleticUpper->append(startTime, 13.0);
-            athleticUpper->append(endTime, 13.0);
-            athleticLower->append(startTime, 6.0);
-            athleticLower->append(endTime, 6.0);
-        }
-        
-        // Fitness (14-17%)
-        if (fitnessUpper && fitnessLower) {
-            fitnessUpper->clear();
-            fitnessLower->clear();
-            fitnessUpper->append(startTime, 17.0);
-            fitnessUpper->append(endTime, 17.0);
-            fitnessLower->append(startTime, 14.0);
-            fitnessLower->append(endTime, 14.0);
-        }
-        
-        // Average (18-24%)
-        if (averageUpper && averageLower) {
-            averageUpper->clear();
-            averageLower->clear();
-            averageUpper->append(startTime, 24.0);
-            averageUpper->append(endTime, 24.0);
-            averageLower->append(startTime, 18.0);
-            averageLower->append(endTime, 18.0);
-        }
-        
-        // Obese (25%+)
-        if (obeseUpper && obeseLower) {
-            obeseUpper->clear();
-            obeseLower->clear();
-            obeseUpper->append(startTime, 40.0);
-            obeseUpper->append(endTime, 40.0);
-            obeseLower->append(startTime, 25.0);
-            obeseLower->append(endTime, 25.0);
-        }
+    // Get the time range for this chart update
+    int days = m_timeRangeCombo->currentData().toInt();
+    QDate endDate = QDate::currentDate();
+    QDate startDate;
+    qint64 startTime, endTime;
+    
+    if (days == -1) {
+        // Use data range for "All Time"  
+        startTime = data.first().date().startOfDay().toMSecsSinceEpoch();
+        endTime = data.last().date().startOfDay().toMSecsSinceEpoch();
+    } else {
+        // Use requested time window
+        startDate = endDate.addDays(-days);
+        startTime = startDate.startOfDay().toMSecsSinceEpoch();
+        endTime = endDate.startOfDay().toMSecsSinceEpoch();
     }
     
+    updateCategoryBand(m_bodyFatEssentialArea, startTime, endTime, 2.0, 5.0);
+    updateCategoryBand(m_bodyFatAthleticArea, startTime, endTime, 6.0, 13.0);
+    updateCategoryBand(m_bodyFatFitnessArea, startTime, endTime, 14.0, 17.0);
+    updateCategoryBand(m_bodyFatAverageArea, startTime, endTime, 18.0, 24.0);
+    updateCategoryBand(m_bodyFatObeseArea, startTime, endTime, 25.0, 40.0);
+    
     // Dynamically set axis ranges based on filtered data
-    if (m_bodyFatChart && !data.isEmpty()) {
+    if (m_bodyFatChart) {
         QList<QAbstractAxis*> axesX = m_bodyFatChart->axes(Qt::Horizontal);
         QList<QAbstractAxis*> axesY = m_bodyFatChart->axes(Qt::Vertical);
         
@@ -702,16 +744,17 @@ void AnalyticsTab::updateBodyFatChart()
 
 void AnalyticsTab::updateWaistChart()
 {
+    TRACE_SCOPE("AnalyticsTab::updateWaistChart");
     if (!m_waistSeries) return;
     
-    m_waistSeries->clear();
-    
     QList<BodyComposition> data = getFilteredData();
     if (data.isEmpty()) {
+        SeriesUpdater::apply(m_waistSeries, QList<QPointF>());
         return;
     }
     
-    int pointsAdded = 0;
+    QList<QPointF> points;
+    points.reserve(data.size());
     for (const BodyComposition &composition : data) {
         if (composition.waistCircumference() > 0) {
             QDate date = composition.date();
@@ -719,12 +762,13 @@ void AnalyticsTab::updateWaistChart()
                 continue;
             }
             qint64 timestamp = date.startOfDay().toMSecsSinceEpoch();
-            m_waistSeries->append(timestamp, composition.waistCircumference());
-            pointsAdded++;
+            points.append(QPointF(timestamp, composition.waistCircumference()));
         }
     }
+    int pointsAdded = points.size();
+    SeriesUpdater::apply(m_waistSeries, points);
     
-    printf("updateWaistChart: Added %d points to series\n", pointsAdded);
+    qCDebug(lcAnalytics) << "updateWaistChart:" << pointsAdded << "points";
     
     // Dynamically set axis ranges based on filtered data
     if (m_waistChart && pointsAdded > 0 && !data.isEmpty()) {
@@ -745,21 +789,217 @@ void AnalyticsTab::updateWaistChart()
         
         if (!axesY.isEmpty()) {
             if (QValueAxis* valueAxis = qobject_cast<QValueAxis*>(axesY.first())) {
-                // Calculate waist range from data
-                double minWaist = 999, maxWaist = 0;
-                for (const BodyComposition &comp : data) {
-                    if (comp.waistCircumference() > 0) {
-                        minWaist = qMin(minWaist, comp.waistCircumference());
-                        maxWaist = qMax(maxWaist, comp.waistCircumference());
-                    }
-                }
-                if (minWaist < 999) {
-                    double padding = (maxWaist - minWaist) * 0.1;
-                    valueAxis->setRange(minWaist - padding, maxWaist + padding);
+                // Waist range for the selected window comes straight from the aggregate index
+                QDate startDate, endDate;
+                getFilterDateRange(startDate, endDate);
+                BodyCompositionIndex::RangeStats waist =
+                    m_dataManager->getBodyCompositionStats(BodyCompositionIndex::Waist, startDate, endDate);
+                if (!waist.isEmpty()) {
+                    double padding = (waist.max - waist.min) * 0.1;
+                    valueAxis->setRange(waist.min - padding, waist.max + padding);
                 } else {
                     valueAxis->setRange(30, 50); // Default if no data
                 }
             }
         }
     }
-}
\ No newline at end of file
+}
+
+void AnalyticsTab::updateTrendSeries(QLineSeries *series, BodyCompositionIndex::Metric metric)
+{
+    if (!series) return;
+    
+    int method = m_trendCombo->currentData().toInt();
+    if (method < 0) {
+        SeriesUpdater::apply(series, QList<QPointF>());
+        series->setVisible(false);
+        return;
+    }
+    
+    // Trend state is maintained incrementally by DataManager, so this only reads the window
+    QDate startDate, endDate;
+    getFilterDateRange(startDate, endDate);
+    QList<TrendFilter::Point> trend = m_dataManager->getTrendPoints(metric, startDate, endDate);
+    
+    QList<QPointF> points;
+    points.reserve(trend.size());
+    for (const TrendFilter::Point &point : trend) {
+        qint64 timestamp = point.date.startOfDay().toMSecsSinceEpoch();
+        points.append(QPointF(timestamp, point.estimate(static_cast<TrendFilter::Method>(method))));
+    }
+    
+    SeriesUpdater::apply(series, points);
+    series->setVisible(true);
+}
+
+void AnalyticsTab::updateCategoryBand(QAreaSeries *area, qint64 startTime, qint64 endTime, double lower, double upper)
+{
+    if (!area) return;
+    
+    SeriesUpdater::apply(area->upperSeries(), {QPointF(startTime, upper), QPointF(endTime, upper)});
+    SeriesUpdater::apply(area->lowerSeries(), {QPointF(startTime, lower), QPointF(endTime, lower)});
+}
+
+void AnalyticsTab::setupGoalSeries(QChart *chart, QAreaSeries *&band, QLineSeries *&median)
+{
+    band = new QAreaSeries(new QLineSeries(), new QLineSeries());
+    band->setName("Projection (10-90%)");
+    band->setBrush(QBrush(QColor(111, 66, 193, 50)));
+    band->setPen(Qt::NoPen);
+    
+    median = new QLineSeries();
+    median->setName("Projection (median)");
+    median->setPen(QPen(QColor(111, 66, 193), 2, Qt::DotLine));
+    
+    chart->addSeries(band);
+    chart->addSeries(median);
+    for (QAbstractAxis *axis : chart->axes()) {
+        band->attachAxis(axis);
+        median->attachAxis(axis);
+    }
+    band->setVisible(false);
+    median->setVisible(false);
+}
+
+double AnalyticsTab::goalValue() const
+{
+    return m_goalSlider->value() / 10.0;
+}
+
+void AnalyticsTab::onGoalMetricChanged()
+{
+    int metric = m_goalCombo->currentData().toInt();
+    m_goalSlider->setEnabled(metric >= 0);
+    
+    if (metric >= 0) {
+        // Start the slider a little below the current trend value
+        QList<TrendFilter::Point> trend = m_dataManager->getTrendPoints(
+            static_cast<BodyCompositionIndex::Metric>(metric), QDate::currentDate().addDays(-365));
+        double current = trend.isEmpty() ? (metric == BodyCompositionIndex::Weight ? 180.0 : 20.0)
+                                         : trend.last().kalman;
+        
+        QSignalBlocker blocker(m_goalSlider);
+        if (metric == BodyCompositionIndex::Weight) {
+            m_goalSlider->setRange(qRound(qMax(50.0, current - 60.0) * 10), qRound((current + 60.0) * 10));
+            m_goalSlider->setValue(qRound((current - 10.0) * 10));
+        } else {
+            m_goalSlider->setRange(30, 450);
+            m_goalSlider->setValue(qRound(qMax(3.0, current - 3.0) * 10));
+        }
+    }
+    
+    updateGoalProjection();
+}
+
+void AnalyticsTab::updateGoalProjection()
+{
+    if (!m_goalCombo) return;
+    
+    int metric = m_goalCombo->currentData().toInt();
+    GoalProjection::Result projection;
+    if (metric >= 0) {
+        projection = m_dataManager->projectGoal(static_cast<BodyCompositionIndex::Metric>(metric), goalValue());
+    }
+    
+    GoalProjection::Result none;
+    applyGoalProjection(m_weightChart, m_weightGoalBand, m_weightGoalMedian,
+                        metric == BodyCompositionIndex::Weight ? projection : none);
+    applyGoalProjection(m_bodyFatChart, m_bodyFatGoalBand, m_bodyFatGoalMedian,
+                        metric == BodyCompositionIndex::BodyFat ? projection : none);
+    
+    if (metric < 0) {
+        m_goalLabel->clear();
+        return;
+    }
+    
+    QString unit = metric == BodyCompositionIndex::Weight ? " lbs" : "%";
+    QString text = QString("%1%2").arg(goalValue(), 0, 'f', 1).arg(unit);
+    if (!projection.isValid()) {
+        m_goalLabel->setText(text + " - not enough recent entries to project");
+        return;
+    }
+    
+    if (projection.expectedDate.isValid()) {
+        text += QString(" - expected %1").arg(projection.expectedDate.toString("MMM d, yyyy"));
+        if (projection.optimisticDate.isValid()) {
+            text += QString(" (10%: %1").arg(projection.optimisticDate.toString("MMM d"));
+            text += projection.conservativeDate.isValid()
+                        ? QString(", 90%: %1)").arg(projection.conservativeDate.toString("MMM d, yyyy"))
+                        : QString(", 90%: beyond a year)");
+        }
+    } else {
+        text += " - unlikely within a year";
+    }
+    text += QString("  |  %1% chance within a year").arg(qRound(projection.probability * 100));
+    m_goalLabel->setText(text);
+}
+
+void AnalyticsTab::applyGoalProjection(QChart *chart, QAreaSeries *band, QLineSeries *median,
+                                       const GoalProjection::Result &projection)
+{
+    if (!chart || !band || !median) return;
+    
+    QList<QPointF> upper;
+    QList<QPointF> lower;
+    QList<QPointF> middle;
+    QDate shownUntil;
+    double minValue = projection.goal;
+    double maxValue = projection.goal;
+    
+    if (projection.isValid()) {
+        // Show the band up to a little past the likely arrival, or the whole
+        // horizon when the goal is out of reach
+        shownUntil = projection.bands.last().date;
+        if (projection.conservativeDate.isValid()) {
+            shownUntil = qMin(shownUntil, projection.conservativeDate.addDays(14));
+        } else if (projection.expectedDate.isValid()) {
+            shownUntil = qMin(shownUntil, projection.expectedDate.addDays(60));
+        }
+        
+        for (const GoalProjection::BandPoint &point : projection.bands) {
+            if (point.date > shownUntil) {
+                break;
+            }
+            qint64 timestamp = point.date.startOfDay().toMSecsSinceEpoch();
+            upper.append(QPointF(timestamp, point.p90));
+            lower.append(QPointF(timestamp, point.p10));
+            middle.append(QPointF(timestamp, point.p50));
+            minValue = qMin(minValue, point.p10);
+            maxValue = qMax(maxValue, point.p90);
+        }
+    }
+    
+    SeriesUpdater::apply(band->upperSeries(), upper);
+    SeriesUpdater::apply(band->lowerSeries(), lower);
+    SeriesUpdater::apply(median, middle);
+    band->setVisible(!middle.isEmpty());
+    median->setVisible(!middle.isEmpty());
+    
+    // Axes go back to the chart's own range, extended to keep the projection in view
+    QList<QAbstractAxis*> axesX = chart->axes(Qt::Horizontal);
+    QList<QAbstractAxis*> axesY = chart->axes(Qt::Vertical);
+    if (!axesX.isEmpty()) {
+        if (QDateTimeAxis *dateAxis = qobject_cast<QDateTimeAxis*>(axesX.first())) {
+            QDate end = dateAxisEnd();
+            if (shownUntil.isValid() && shownUntil > end) {
+                end = shownUntil;
+            }
+            dateAxis->setMax(end.startOfDay());
+        }
+    }
+    if (!axesY.isEmpty()) {
+        if (QValueAxis *valueAxis = qobject_cast<QValueAxis*>(axesY.first())) {
+            // Body fat keeps its fixed 0-40% range unless a goal goes past it
+            QPair<double, double> range = chart == m_weightChart ? weightAxisRange()
+                                                                 : QPair<double, double>(0.0, 40.0);
+            if (!middle.isEmpty()) {
+                range.first = qMin(range.first, minValue - 2.0);
+                range.second = qMax(range.second, maxValue + 2.0);
+            }
+            if (chart == m_bodyFatChart) {
+                range.first = qMax(0.0, range.first);
+            }
+            valueAxis->setRange(range.first, range.second);
+        }
+    }
+}
@@ -14,8 +14,15 @@
 #include <QLabel>
 #include <QComboBox>
 #include <QPushButton>
+#include <QSlider>
+#include <QTimer>
 #include "models/datamanager.h"
 
+class StrengthTab;
+class VolumeTab;
+class TrainingLoadTab;
+class ActivityTab;
+
 class AnalyticsTab : public QWidget
 {
     Q_OBJECT
@@ -23,10 +30,16 @@ class AnalyticsTab : public QWidget
 public:
     explicit AnalyticsTab(DataManager *dataManager, QWidget *parent = nullptr);
 
+public slots:
+    // Rebuilds every chart for the selected time range
+    void refreshCharts();
+
 private slots:
     void onDataChanged();
     void onTimeRangeChanged();
-    void refreshCharts();
+    void onTrendMethodChanged();
+    void onGoalMetricChanged();
+    void updateGoalProjection();
 
 private:
     void setupUI();
@@ -41,15 +54,37 @@ private:
     void updateWaistChart();
     
     void setupChartAppearance(QChart *chart, const QString &title);
+    void updateTrendSeries(QLineSeries *series, BodyCompositionIndex::Metric metric);
+    void setupGoalSeries(QChart *chart, QAreaSeries *&band, QLineSeries *&median);
+    void applyGoalProjection(QChart *chart, QAreaSeries *band, QLineSeries *median,
+                             const GoalProjection::Result &projection);
+    double goalValue() const;
+    void updateCategoryBand(QAreaSeries *area, qint64 startTime, qint64 endTime, double lower, double upper);
     QList<BodyComposition> getFilteredData();
+    void getFilterDateRange(QDate &startDate, QDate &endDate) const;
+    void updateSummary();
     void setDateAxisRange(QDateTimeAxis* dateAxis, const QList<BodyComposition>& data);
+    QPair<double, double> weightAxisRange() const;
+    QDate dateAxisEnd() const;
     
     DataManager *m_dataManager;
     
     // UI Components
     QTabWidget *m_chartTabs;
     QComboBox *m_timeRangeCombo;
+    QComboBox *m_trendCombo;
     QPushButton *m_refreshButton;
+    QLabel *m_summaryLabel;
+    StrengthTab *m_strengthTab;
+    
+    // Goal projection controls
+    QComboBox *m_goalCombo;
+    QSlider *m_goalSlider;
+    QLabel *m_goalLabel;
+    QTimer *m_goalTimer;
+    VolumeTab *m_volumeTab;
+    TrainingLoadTab *m_trainingLoadTab;
+    ActivityTab *m_activityTab;
     
     // Charts
     QChartView *m_weightChartView;
@@ -68,6 +103,16 @@ private:
     QLineSeries *m_bodyFatSeries;
     QLineSeries *m_waistSeries;
     
+    // Smoothed trend overlays
+    QLineSeries *m_weightTrendSeries;
+    QLineSeries *m_bodyFatTrendSeries;
+    
+    // Goal projection: 10-90% band and median
+    QAreaSeries *m_weightGoalBand;
+    QLineSeries *m_weightGoalMedian;
+    QAreaSeries *m_bodyFatGoalBand;
+    QLineSeries *m_bodyFatGoalMedian;
+    
     // BMI category areas
     QAreaSeries *m_underweightArea;
     QAreaSeries *m_normalArea;
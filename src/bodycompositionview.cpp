@@ -2,6 +2,17 @@
 #include <QMessageBox>
 #include "utils/calculations.h"
 
+namespace {
+// Setting a style sheet re-polishes the widget even when nothing changed,
+// which adds up when stepping through days
+void setStyleSheetIfChanged(QWidget *widget, const QString &styleSheet)
+{
+    if (widget->styleSheet() != styleSheet) {
+        widget->setStyleSheet(styleSheet);
+    }
+}
+}
+
 BodyCompositionView::BodyCompositionView(QWidget *parent)
     : QWidget(parent)
 {
@@ -130,10 +141,10 @@ void BodyCompositionView::updateDisplay()
     
     if (m_data.notes().isEmpty()) {
         m_notesLabel->setText("No notes");
-        m_notesLabel->setStyleSheet("QLabel { font-size: 14px; color: #666; font-style: italic; padding: 5px; }");
+        setStyleSheetIfChanged(m_notesLabel, "QLabel { font-size: 14px; color: #666; font-style: italic; padding: 5px; }");
     } else {
         m_notesLabel->setText(m_data.notes());
-        m_notesLabel->setStyleSheet("QLabel { font-size: 14px; padding: 5px; }");
+        setStyleSheetIfChanged(m_notesLabel, "QLabel { font-size: 14px; padding: 5px; }");
     }
     
     m_timestampLabel->setText(QString("Last updated: %1").arg(m_data.timestamp().toString("MMM dd, yyyy h:mm AP")));
@@ -141,11 +152,11 @@ void BodyCompositionView::updateDisplay()
     // Update calculations
     QString bmiText = Calculations::formatBMI(m_data.bmi());
     m_bmiLabel->setText(QString("BMI: %1").arg(bmiText));
-    m_bmiLabel->setStyleSheet("QLabel { font-size: 14px; padding: 5px; }");
+    setStyleSheetIfChanged(m_bmiLabel, "QLabel { font-size: 14px; padding: 5px; }");
     
     QString bodyFatText = Calculations::formatBodyFat(m_data.bodyFatPercentage(), m_data.isMale());
     m_bodyFatLabel->setText(QString("Body Fat: %1").arg(bodyFatText));
-    m_bodyFatLabel->setStyleSheet("QLabel { font-size: 14px; padding: 5px; }");
+    setStyleSheetIfChanged(m_bodyFatLabel, "QLabel { font-size: 14px; padding: 5px; }");
 }
 
 void BodyCompositionView::onEditClicked()
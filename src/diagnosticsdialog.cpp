@@ -0,0 +1,170 @@
+#include "diagnosticsdialog.h"
+#include "utils/allocationcounter.h"
+#include "utils/latencyhistogram.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QFile>
+#include <QShowEvent>
+#include <QHideEvent>
+
+DiagnosticsDialog::DiagnosticsDialog(DataManager *dataManager, QWidget *parent)
+    : QDialog(parent)
+    , m_dataManager(dataManager)
+    , m_latencyTable(nullptr)
+    , m_countsLabel(nullptr)
+    , m_fileLabel(nullptr)
+    , m_memoryLabel(nullptr)
+    , m_resetButton(nullptr)
+    , m_refreshTimer(nullptr)
+{
+    setWindowTitle("Performance Diagnostics");
+    setupUI();
+    
+    m_refreshTimer = new QTimer(this);
+    m_refreshTimer->setInterval(1000);
+    connect(m_refreshTimer, &QTimer::timeout, this, &DiagnosticsDialog::refresh);
+}
+
+void DiagnosticsDialog::setupUI()
+{
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+    
+    // Latency table, one row per metric
+    m_latencyTable = new QTableWidget(Latency::MetricCount, 6);
+    m_latencyTable->setHorizontalHeaderLabels(QStringList() << "Count" << "Mean" << "p50" << "p90" << "p99" << "Max");
+    QStringList rowLabels;
+    for (int i = 0; i < Latency::MetricCount; ++i) {
+        rowLabels << Latency::name(Latency::Metric(i));
+    }
+    m_latencyTable->setVerticalHeaderLabels(rowLabels);
+    m_latencyTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_latencyTable->setSelectionMode(QAbstractItemView::NoSelection);
+    m_latencyTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    for (int row = 0; row < Latency::MetricCount; ++row) {
+        for (int column = 0; column < 6; ++column) {
+            QTableWidgetItem *item = new QTableWidgetItem;
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            m_latencyTable->setItem(row, column, item);
+        }
+    }
+    mainLayout->addWidget(m_latencyTable);
+    
+    // Data and process figures
+    m_countsLabel = new QLabel;
+    m_fileLabel = new QLabel;
+    m_fileLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    m_memoryLabel = new QLabel;
+    mainLayout->addWidget(m_countsLabel);
+    mainLayout->addWidget(m_fileLabel);
+    mainLayout->addWidget(m_memoryLabel);
+    
+    // Buttons
+    QHBoxLayout *buttonLayout = new QHBoxLayout();
+    m_resetButton = new QPushButton("Reset Histograms");
+    connect(m_resetButton, &QPushButton::clicked, this, &DiagnosticsDialog::onResetClicked);
+    QPushButton *closeButton = new QPushButton("Close");
+    connect(closeButton, &QPushButton::clicked, this, &QDialog::close);
+    buttonLayout->addWidget(m_resetButton);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(closeButton);
+    mainLayout->addLayout(buttonLayout);
+    
+    resize(640, 320);
+}
+
+void DiagnosticsDialog::showEvent(QShowEvent *event)
+{
+    QDialog::showEvent(event);
+    refresh();
+    m_refreshTimer->start();
+}
+
+void DiagnosticsDialog::hideEvent(QHideEvent *event)
+{
+    m_refreshTimer->stop();
+    QDialog::hideEvent(event);
+}
+
+void DiagnosticsDialog::refresh()
+{
+    for (int row = 0; row < Latency::MetricCount; ++row) {
+        LatencyHistogram::Summary summary = Latency::histogram(Latency::Metric(row)).summary();
+        bool empty = summary.count == 0;
+        m_latencyTable->item(row, 0)->setText(QString::number(summary.count));
+        m_latencyTable->item(row, 1)->setText(empty ? "-" : formatDuration(qint64(summary.mean)));
+        m_latencyTable->item(row, 2)->setText(empty ? "-" : formatDuration(summary.p50));
+        m_latencyTable->item(row, 3)->setText(empty ? "-" : formatDuration(summary.p90));
+        m_latencyTable->item(row, 4)->setText(empty ? "-" : formatDuration(summary.p99));
+        m_latencyTable->item(row, 5)->setText(empty ? "-" : formatDuration(summary.max));
+    }
+    
+    DataManager::Stats stats = m_dataManager->getStats();
+    m_countsLabel->setText(QString("Body composition entries: %1    Workouts: %2    Exercises: %3    Notes: %4")
+                           .arg(stats.bodyCompositionEntries)
+                           .arg(stats.workouts)
+                           .arg(stats.exercises)
+                           .arg(stats.notes));
+    m_fileLabel->setText(QString("Data file: %1 (%2)").arg(stats.dataFilePath, formatBytes(stats.dataFileBytes)));
+    
+    qint64 rss = residentSetBytes();
+    QString memory = QString("Resident memory: %1").arg(rss >= 0 ? formatBytes(rss) : QString("n/a"));
+    
+    // Only Debug and benchmark builds count allocations
+    if (AllocationCounter::isAvailable()) {
+        AllocationCounter::Counts heap = AllocationCounter::current();
+        memory += QString("    Heap allocations: %1 (%2 requested, %3 live)")
+                      .arg(heap.allocations)
+                      .arg(formatBytes(heap.bytes))
+                      .arg(heap.allocations - heap.deallocations);
+    }
+    m_memoryLabel->setText(memory);
+}
+
+void DiagnosticsDialog::onResetClicked()
+{
+    Latency::resetAll();
+    refresh();
+}
+
+QString DiagnosticsDialog::formatDuration(qint64 ns)
+{
+    if (ns < 1000) {
+        return QString("%1 ns").arg(ns);
+    } else if (ns < 1000000) {
+        return QString("%1 µs").arg(ns / 1e3, 0, 'f', 1);
+    } else if (ns < 1000000000) {
+        return QString("%1 ms").arg(ns / 1e6, 0, 'f', 2);
+    }
+    return QString("%1 s").arg(ns / 1e9, 0, 'f', 2);
+}
+
+QString DiagnosticsDialog::formatBytes(qint64 bytes)
+{
+    if (bytes < 1024) {
+        return QString("%1 B").arg(bytes);
+    } else if (bytes < 1024 * 1024) {
+        return QString("%1 KiB").arg(bytes / 1024.0, 0, 'f', 1);
+    }
+    return QString("%1 MiB").arg(bytes / (1024.0 * 1024.0), 0, 'f', 1);
+}
+
+qint64 DiagnosticsDialog::residentSetBytes()
+{
+    // Linux only; other platforms show n/a
+    QFile status("/proc/self/status");
+    if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return -1;
+    }
+    
+    while (!status.atEnd()) {
+        QByteArray line = status.readLine();
+        if (line.startsWith("VmRSS:")) {
+            QList<QByteArray> fields = line.simplified().split(' ');
+            if (fields.size() >= 2) {
+                return fields.at(1).toLongLong() * 1024;  // reported in kB
+            }
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,46 @@
+#ifndef DIAGNOSTICSDIALOG_H
+#define DIAGNOSTICSDIALOG_H
+
+#include <QDialog>
+#include <QLabel>
+#include <QTableWidget>
+#include <QPushButton>
+#include <QTimer>
+#include "models/datamanager.h"
+
+// Live latency percentiles for loads, saves, chart refreshes and date
+// navigation, plus entity counts, data file size and process memory.
+// Refreshes once a second while visible.
+class DiagnosticsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit DiagnosticsDialog(DataManager *dataManager, QWidget *parent = nullptr);
+
+protected:
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+
+private slots:
+    void refresh();
+    void onResetClicked();
+
+private:
+    void setupUI();
+    static QString formatDuration(qint64 ns);
+    static QString formatBytes(qint64 bytes);
+    static qint64 residentSetBytes();
+
+    DataManager *m_dataManager;
+
+    // UI Components
+    QTableWidget *m_latencyTable;
+    QLabel *m_countsLabel;
+    QLabel *m_fileLabel;
+    QLabel *m_memoryLabel;
+    QPushButton *m_resetButton;
+    QTimer *m_refreshTimer;
+};
+
+#endif // DIAGNOSTICSDIALOG_H
@@ -0,0 +1,64 @@
+#include "exercisecompleter.h"
+#include <QHeaderView>
+#include <QTreeView>
+
+namespace {
+constexpr int kMaxSuggestions = 15;
+}
+
+ExerciseCompleter::ExerciseCompleter(DataManager *dataManager, QLineEdit *lineEdit, bool activeOnly)
+    : QCompleter(lineEdit)
+    , m_dataManager(dataManager)
+    , m_matchesModel(new QStandardItemModel(this))
+    , m_activeOnly(activeOnly)
+{
+    setModel(m_matchesModel);
+    setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    setMaxVisibleItems(kMaxSuggestions);
+
+    // Name and category in separate columns: a QComboBox hosting the
+    // completer selects the item whose text matches the completed one
+    QTreeView *view = new QTreeView();
+    view->setHeaderHidden(true);
+    view->setRootIsDecorated(false);
+    view->setUniformRowHeights(true);
+    view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    setPopup(view);
+    view->header()->setStretchLastSection(false);
+    view->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    view->header()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
+
+    // Refresh the matches before the line edit asks for completion
+    connect(lineEdit, &QLineEdit::textEdited, this, &ExerciseCompleter::updateMatches);
+    connect(this, QOverload<const QModelIndex &>::of(&QCompleter::activated),
+            this, &ExerciseCompleter::onActivated);
+}
+
+void ExerciseCompleter::updateMatches(const QString &text)
+{
+    m_matchesModel->clear();
+
+    const QList<ExerciseSearchIndex::Match> matches = m_dataManager->searchExercises(text, kMaxSuggestions, m_activeOnly);
+    for (const ExerciseSearchIndex::Match &match : matches) {
+        Exercise exercise = m_dataManager->loadExercise(match.exerciseId);
+        QStandardItem *name = new QStandardItem(exercise.name());
+        name->setData(exercise.id(), IdRole);
+        QStandardItem *category = new QStandardItem(exercise.category());
+        category->setData(exercise.id(), IdRole);
+        m_matchesModel->appendRow({name, category});
+    }
+
+    if (matches.isEmpty()) {
+        popup()->hide();
+    } else {
+        complete();
+    }
+}
+
+void ExerciseCompleter::onActivated(const QModelIndex &index)
+{
+    int exerciseId = index.data(IdRole).toInt();
+    if (exerciseId > 0) {
+        emit exerciseActivated(exerciseId);
+    }
+}
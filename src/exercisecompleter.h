@@ -0,0 +1,39 @@
+#ifndef EXERCISECOMPLETER_H
+#define EXERCISECOMPLETER_H
+
+#include <QCompleter>
+#include <QStandardItemModel>
+#include <QLineEdit>
+#include "models/datamanager.h"
+
+// Popup completion for exercise names backed by DataManager's search index.
+// The popup lists the ranked, typo-tolerant matches for the text typed so far
+// rather than QCompleter's own prefix filtering.
+//
+// The owner installs it with setCompleter() on the line edit, or on the
+// combo box when the line edit belongs to one.
+class ExerciseCompleter : public QCompleter
+{
+    Q_OBJECT
+
+public:
+    ExerciseCompleter(DataManager *dataManager, QLineEdit *lineEdit, bool activeOnly = true);
+
+signals:
+    void exerciseActivated(int exerciseId);
+
+private slots:
+    void updateMatches(const QString &text);
+    void onActivated(const QModelIndex &index);
+
+private:
+    enum Roles {
+        IdRole = Qt::UserRole + 1
+    };
+
+    DataManager *m_dataManager;
+    QStandardItemModel *m_matchesModel;
+    bool m_activeOnly;
+};
+
+#endif // EXERCISECOMPLETER_H
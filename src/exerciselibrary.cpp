@@ -4,11 +4,11 @@
 ExerciseLibrary::ExerciseLibrary(DataManager *dataManager, QWidget *parent)
     : QWidget(parent)
     , m_dataManager(dataManager)
+    , m_filterTimer(nullptr)
     , m_currentExerciseId(0)
     , m_isEditing(false)
 {
     setupUI();
-    populateTable();
 }
 
 void ExerciseLibrary::setupUI()
@@ -59,55 +59,90 @@ void ExerciseLibrary::setupUI()
     mainLayout->addLayout(buttonLayout);
     
     // Table
+    m_filterEdit = new QLineEdit();
+    m_filterEdit->setPlaceholderText("Search exercises by name or category...");
+    m_filterEdit->setClearButtonEnabled(true);
+    mainLayout->addWidget(m_filterEdit);
+    
     setupTable();
     mainLayout->addWidget(m_exercisesTable);
 }
 
 void ExerciseLibrary::setupTable()
 {
-    m_exercisesTable = new QTableWidget();
-    m_exercisesTable->setColumnCount(4);
-    m_exercisesTable->setHorizontalHeaderLabels({"ID", "Name", "Category", "Status"});
+    // Shared model; sorting and filtering happen in the proxy
+    m_proxyModel = new ExerciseFilterModel(this);
+    m_proxyModel->setSourceModel(m_dataManager->getExerciseModel());
+    
+    m_exercisesTable = new QTableView();
+    m_exercisesTable->setModel(m_proxyModel);
+    m_exercisesTable->setSortingEnabled(true);
+    m_exercisesTable->sortByColumn(ExerciseModel::IdColumn, Qt::AscendingOrder);
+    m_exercisesTable->verticalHeader()->hide();
     m_exercisesTable->horizontalHeader()->setStretchLastSection(true);
     m_exercisesTable->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_exercisesTable->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_exercisesTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    
+    // Searching and refiltering every row on each keystroke makes typing lag
+    // on large libraries; the filter applies once typing pauses
+    m_filterTimer = new QTimer(this);
+    m_filterTimer->setSingleShot(true);
+    m_filterTimer->setInterval(150);
+    connect(m_filterTimer, &QTimer::timeout, this, &ExerciseLibrary::applyFilter);
+    connect(m_filterEdit, &QLineEdit::textChanged, this, &ExerciseLibrary::onFilterChanged);
+    connect(m_exercisesTable->selectionModel(), &QItemSelectionModel::selectionChanged,
+            this, &ExerciseLibrary::onSelectionChanged);
+}
+
+void ExerciseLibrary::onSelectionChanged()
+{
+    QModelIndexList selectedRows = m_exercisesTable->selectionModel()->selectedRows();
+    if (selectedRows.isEmpty()) {
+        return;
+    }
     
-    connect(m_exercisesTable, &QTableWidget::itemSelectionChanged, [this]() {
-        QList<QTableWidgetItem*> selectedItems = m_exercisesTable->selectedItems();
-        if (!selectedItems.isEmpty()) {
-            int row = selectedItems.first()->row();
-            int exerciseId = m_exercisesTable->item(row, 0)->text().toInt();
-            
-            Exercise exercise = m_dataManager->loadExercise(exerciseId);
-            if (exercise.id() > 0) {
-                m_currentExerciseId = exercise.id();
-                m_nameEdit->setText(exercise.name());
-                m_categoryCombo->setCurrentText(exercise.category());
-                
-                m_addButton->setEnabled(false);
-                m_editButton->setEnabled(true);
-                m_deleteButton->setEnabled(true);
-                m_isEditing = true;
-            }
-        }
-    });
+    int exerciseId = selectedRows.first().data(ExerciseModel::IdRole).toInt();
+    Exercise exercise = m_dataManager->loadExercise(exerciseId);
+    if (exercise.id() > 0) {
+        m_currentExerciseId = exercise.id();
+        m_nameEdit->setText(exercise.name());
+        m_categoryCombo->setCurrentText(exercise.category());
+        
+        m_addButton->setEnabled(false);
+        m_editButton->setEnabled(true);
+        m_deleteButton->setEnabled(true);
+        m_isEditing = true;
+    }
+}
+
+void ExerciseLibrary::onFilterChanged(const QString &text)
+{
+    // Clearing the search is cheap, so it shows at once
+    if (ExerciseSearchIndex::normalize(text).isEmpty()) {
+        m_filterTimer->stop();
+        m_proxyModel->clearMatches();
+        return;
+    }
+    m_filterTimer->start();
 }
 
-void ExerciseLibrary::populateTable()
+void ExerciseLibrary::applyFilter()
 {
-    m_exercisesTable->setRowCount(0);
+    m_filterTimer->stop();
     
-    QList<Exercise> exercises = m_dataManager->getAllExercises();
+    QString text = m_filterEdit->text();
+    if (ExerciseSearchIndex::normalize(text).isEmpty()) {
+        m_proxyModel->clearMatches();
+        return;
+    }
     
-    for (const Exercise &exercise : exercises) {
-        int row = m_exercisesTable->rowCount();
-        m_exercisesTable->insertRow(row);
-        
-        m_exercisesTable->setItem(row, 0, new QTableWidgetItem(QString::number(exercise.id())));
-        m_exercisesTable->setItem(row, 1, new QTableWidgetItem(exercise.name()));
-        m_exercisesTable->setItem(row, 2, new QTableWidgetItem(exercise.category()));
-        m_exercisesTable->setItem(row, 3, new QTableWidgetItem(exercise.isActive() ? "Active" : "Inactive"));
+    // Typo-tolerant matches on name and category from the search index
+    QSet<int> matches;
+    for (const ExerciseSearchIndex::Match &match : m_dataManager->searchExercises(text, 0)) {
+        matches.insert(match.exerciseId);
     }
+    m_proxyModel->setMatches(matches);
 }
 
 void ExerciseLibrary::addExercise()
@@ -122,7 +157,7 @@ void ExerciseLibrary::addExercise()
         showSuccess("Exercise added successfully!");
         emit exerciseAdded();
         clearForm();
-        populateTable();
+        applyFilter();
     } else {
         showError("Failed to add exercise. Please check your data.");
     }
@@ -147,7 +182,7 @@ void ExerciseLibrary::editExercise()
         showSuccess("Exercise updated successfully!");
         emit exerciseUpdated();
         clearForm();
-        populateTable();
+        applyFilter();
     } else {
         showError("Failed to update exercise. Please check your data.");
     }
@@ -171,7 +206,6 @@ void ExerciseLibrary::deleteExercise()
             showSuccess("Exercise deleted successfully!");
             emit exerciseDeleted();
             clearForm();
-            populateTable();
         } else {
             showError("Failed to delete exercise.");
         }
@@ -192,11 +226,6 @@ void ExerciseLibrary::clearForm()
     m_exercisesTable->clearSelection();
 }
 
-void ExerciseLibrary::refreshTable()
-{
-    populateTable();
-}
-
 bool ExerciseLibrary::validateForm()
 {
     if (m_nameEdit->text().trimmed().isEmpty()) {
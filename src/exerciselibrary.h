@@ -9,10 +9,10 @@
 #include <QLineEdit>
 #include <QPushButton>
 #include <QComboBox>
-#include <QTableWidget>
-#include <QTableWidgetItem>
+#include <QTableView>
 #include <QHeaderView>
 #include <QMessageBox>
+#include <QTimer>
 #include <QList>
 #include "models/datamanager.h"
 #include "models/exercise.h"
@@ -34,12 +34,13 @@ private slots:
     void editExercise();
     void deleteExercise();
     void clearForm();
-    void refreshTable();
+    void onSelectionChanged();
+    void onFilterChanged(const QString &text);
+    void applyFilter();
 
 private:
     void setupUI();
     void setupTable();
-    void populateTable();
     bool validateForm();
     void showError(const QString &message);
     void showSuccess(const QString &message);
@@ -53,7 +54,10 @@ private:
     QPushButton *m_editButton;
     QPushButton *m_deleteButton;
     QPushButton *m_clearButton;
-    QTableWidget *m_exercisesTable;
+    QLineEdit *m_filterEdit;
+    QTableView *m_exercisesTable;
+    ExerciseFilterModel *m_proxyModel;
+    QTimer *m_filterTimer;
     
     // Current exercise being edited
     int m_currentExerciseId;
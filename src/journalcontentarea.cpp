@@ -1,4 +1,11 @@
 #include "journalcontentarea.h"
+#include "workoutbuilder.h"
+#include "exerciselibrary.h"
+#include "analyticstab.h"
+#include "utils/logging.h"
+#include "utils/latencyhistogram.h"
+#include "utils/trace.h"
+#include <QElapsedTimer>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -7,11 +14,21 @@
 #include <QMessageBox>
 #include <QShortcut>
 #include <QKeySequence>
+#include <QShowEvent>
 
 JournalContentArea::JournalContentArea(DateManager *dateManager, ::DataManager *dataManager, QWidget *parent)
     : QWidget(parent)
     , m_dateManager(dateManager)
     , m_dataManager(dataManager)
+    , m_workoutBuilder(nullptr)
+    , m_exerciseLibrary(nullptr)
+    , m_analyticsTab(nullptr)
+    , m_exerciseLibraryPage(nullptr)
+    , m_analyticsPage(nullptr)
+    , m_warmUpTimer(nullptr)
+    , m_navigationTimer(nullptr)
+    , m_prefetchTimer(nullptr)
+    , m_navigationPending(false)
 {
     setupUI();
     
@@ -30,13 +47,8 @@ JournalContentArea::JournalContentArea(DateManager *dateManager, ::DataManager *
     connect(m_addNewButton, &QPushButton::clicked, this, &JournalContentArea::onAddNewClicked);
     
     // Connect exercise tracking signals
-    connect(m_workoutBuilder, &WorkoutBuilder::workoutCreated, this, &JournalContentArea::onWorkoutCreated);
-    connect(m_workoutBuilder, &WorkoutBuilder::cancelled, this, &JournalContentArea::onWorkoutCancelled);
     connect(m_workoutView, &WorkoutView::editRequested, this, &JournalContentArea::onWorkoutEditRequested);
     connect(m_workoutView, &WorkoutView::deleteRequested, this, &JournalContentArea::onWorkoutDeleteRequested);
-    connect(m_exerciseLibrary, &ExerciseLibrary::exerciseAdded, this, &JournalContentArea::onExerciseAdded);
-    connect(m_exerciseLibrary, &ExerciseLibrary::exerciseUpdated, this, &JournalContentArea::onExerciseUpdated);
-    connect(m_exerciseLibrary, &ExerciseLibrary::exerciseDeleted, this, &JournalContentArea::onExerciseDeleted);
     
     // Setup keyboard shortcuts for tabs
     setupKeyboardShortcuts();
@@ -82,13 +94,11 @@ void JournalContentArea::setupUI()
     m_stackedWidget->addWidget(m_bodyCompositionForm); // Index 1: Form
     m_stackedWidget->addWidget(m_bodyCompositionView); // Index 2: View
     
-    // Create exercise tracking components
-    m_workoutBuilder = new WorkoutBuilder(m_dataManager);
+    // Create exercise tracking components; the builder, library and
+    // analytics are created on demand
     m_workoutView = new WorkoutView(m_dataManager);
-    m_exerciseLibrary = new ExerciseLibrary(m_dataManager);
-    
-    // Create analytics tab
-    m_analyticsTab = new AnalyticsTab(m_dataManager);
+    m_exerciseLibraryPage = createTabPage();
+    m_analyticsPage = createTabPage();
     
     // Create stacked widget for workouts
     m_workoutStackedWidget = new QStackedWidget();
@@ -110,13 +120,14 @@ void JournalContentArea::setupUI()
 
     m_workoutStackedWidget->addWidget(m_workoutEmptyStateWidget); // Index 0: Empty state
     m_workoutStackedWidget->addWidget(m_workoutView);      // Index 1: View
-    m_workoutStackedWidget->addWidget(m_workoutBuilder);   // Index 2: Form
+    // Index 2: Form, added by workoutBuilder()
     
     // Add tabs
     m_tabWidget->addTab(m_stackedWidget, "Body Composition");
     m_tabWidget->addTab(m_workoutStackedWidget, "Workouts");
-    m_tabWidget->addTab(m_exerciseLibrary, "Exercise Library");
-    m_tabWidget->addTab(m_analyticsTab, "Visualizations");
+    m_tabWidget->addTab(m_exerciseLibraryPage, "Exercise Library");
+    m_tabWidget->addTab(m_analyticsPage, "Visualizations");
+    connect(m_tabWidget, &QTabWidget::currentChanged, this, &JournalContentArea::onTabChanged);
     
     // Create main layout
     QVBoxLayout *layout = new QVBoxLayout(this);
@@ -124,10 +135,116 @@ void JournalContentArea::setupUI()
     layout->addWidget(m_tabWidget);
     
     setLayout(layout);
+    
+    // Key repeat fires dateChanged every ~30 ms; renders inside this window
+    // are deferred until the keys are released
+    m_navigationTimer = new QTimer(this);
+    m_navigationTimer->setSingleShot(true);
+    m_navigationTimer->setInterval(80);
+    connect(m_navigationTimer, &QTimer::timeout, this, &JournalContentArea::onNavigationSettled);
+    
+    // Prefetch runs once the event loop is idle after a render
+    m_prefetchTimer = new QTimer(this);
+    m_prefetchTimer->setSingleShot(true);
+    m_prefetchTimer->setInterval(0);
+    connect(m_prefetchTimer, &QTimer::timeout, this, &JournalContentArea::prefetchAdjacentDays);
+    
+    // Idle warm-up builds one deferred tab per tick after the first show
+    m_warmUpTimer = new QTimer(this);
+    m_warmUpTimer->setSingleShot(true);
+    m_warmUpTimer->setInterval(500);
+    connect(m_warmUpTimer, &QTimer::timeout, this, &JournalContentArea::warmUpNextTab);
+}
+
+QWidget *JournalContentArea::createTabPage()
+{
+    QWidget *page = new QWidget;
+    QVBoxLayout *layout = new QVBoxLayout(page);
+    layout->setContentsMargins(0, 0, 0, 0);
+    return page;
+}
+
+WorkoutBuilder *JournalContentArea::workoutBuilder()
+{
+    if (!m_workoutBuilder) {
+        QElapsedTimer timer;
+        timer.start();
+        
+        m_workoutBuilder = new WorkoutBuilder(m_dataManager);
+        m_workoutStackedWidget->addWidget(m_workoutBuilder);   // Index 2: Form
+        connect(m_workoutBuilder, &WorkoutBuilder::workoutCreated, this, &JournalContentArea::onWorkoutCreated);
+        connect(m_workoutBuilder, &WorkoutBuilder::cancelled, this, &JournalContentArea::onWorkoutCancelled);
+        
+        qCInfo(lcStartup) << "Built workout builder in" << timer.elapsed() << "ms";
+    }
+    return m_workoutBuilder;
+}
+
+ExerciseLibrary *JournalContentArea::exerciseLibrary()
+{
+    if (!m_exerciseLibrary) {
+        QElapsedTimer timer;
+        timer.start();
+        
+        m_exerciseLibrary = new ExerciseLibrary(m_dataManager);
+        m_exerciseLibraryPage->layout()->addWidget(m_exerciseLibrary);
+        
+        qCInfo(lcStartup) << "Built exercise library tab in" << timer.elapsed() << "ms";
+    }
+    return m_exerciseLibrary;
+}
+
+AnalyticsTab *JournalContentArea::analyticsTab()
+{
+    if (!m_analyticsTab) {
+        QElapsedTimer timer;
+        timer.start();
+        
+        m_analyticsTab = new AnalyticsTab(m_dataManager);
+        m_analyticsPage->layout()->addWidget(m_analyticsTab);
+        
+        qCInfo(lcStartup) << "Built visualizations tab in" << timer.elapsed() << "ms";
+    }
+    return m_analyticsTab;
+}
+
+void JournalContentArea::onTabChanged(int index)
+{
+    if (index == 2) {
+        exerciseLibrary();
+    } else if (index == 3) {
+        analyticsTab();
+    }
+}
+
+void JournalContentArea::warmUpNextTab()
+{
+    // Cheapest first, so a click during warm-up waits on as little as possible
+    if (!m_workoutBuilder) {
+        workoutBuilder();
+    } else if (!m_exerciseLibrary) {
+        exerciseLibrary();
+    } else if (!m_analyticsTab) {
+        analyticsTab();
+    } else {
+        return;
+    }
+    m_warmUpTimer->start();
+}
+
+void JournalContentArea::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    
+    if (!event->spontaneous() && !m_analyticsTab && !m_warmUpTimer->isActive()) {
+        m_warmUpTimer->start();
+    }
 }
 
 void JournalContentArea::updateContent()
 {
+    TRACE_SCOPE("JournalContentArea::updateContent");
+    LatencyScope latency(Latency::Navigation);
     loadDataForCurrentDate();
 }
 
@@ -144,13 +261,23 @@ void JournalContentArea::loadDataForCurrentDate()
     }
     
     // Load workout data
-    QList<Workout> workouts = m_dataManager->getWorkoutsByDate(currentDate);
     m_workoutView->setDate(currentDate);
-    if (workouts.isEmpty()) {
+    if (!m_workoutView->hasWorkouts()) {
         m_workoutStackedWidget->setCurrentIndex(0); // Show empty state
     } else {
         m_workoutStackedWidget->setCurrentIndex(1); // Show view
     }
+    
+    m_prefetchTimer->start();
+}
+
+void JournalContentArea::flushPendingNavigation()
+{
+    // Actions must see the date the user landed on, not the last rendered one
+    if (m_navigationPending) {
+        m_navigationTimer->stop();
+        onNavigationSettled();
+    }
 }
 
 void JournalContentArea::showEmptyState()
@@ -184,7 +311,30 @@ void JournalContentArea::showBodyCompositionView(const BodyComposition &data)
 
 void JournalContentArea::onDateChanged(const QDate &newDate)
 {
-    updateContent();
+    Q_UNUSED(newDate);
+    
+    if (m_navigationTimer->isActive()) {
+        m_navigationPending = true;
+    } else {
+        updateContent();
+    }
+    m_navigationTimer->start();
+}
+
+void JournalContentArea::onNavigationSettled()
+{
+    if (m_navigationPending) {
+        m_navigationPending = false;
+        updateContent();
+    }
+}
+
+void JournalContentArea::prefetchAdjacentDays()
+{
+    TRACE_SCOPE("JournalContentArea::prefetchAdjacentDays");
+    QDate currentDate = m_dateManager->currentDate();
+    m_workoutView->prefetch(currentDate.addDays(1));
+    m_workoutView->prefetch(currentDate.addDays(-1));
 }
 
 void JournalContentArea::onDataSaved(const BodyComposition &data)
@@ -203,6 +353,7 @@ void JournalContentArea::onCancelled()
 
 void JournalContentArea::onEditRequested()
 {
+    flushPendingNavigation();
     m_bodyCompositionForm->setDate(m_dateManager->currentDate());
     
     // Load current data for editing
@@ -217,6 +368,7 @@ void JournalContentArea::onEditRequested()
 
 void JournalContentArea::onDeleteRequested()
 {
+    flushPendingNavigation();
     QDate currentDate = m_dateManager->currentDate();
     m_dataManager->deleteBodyComposition(currentDate);
     showEmptyState();
@@ -224,6 +376,7 @@ void JournalContentArea::onDeleteRequested()
 
 void JournalContentArea::onAddNewClicked()
 {
+    flushPendingNavigation();
     showBodyCompositionForm();
 }
 
@@ -236,12 +389,13 @@ void JournalContentArea::onWorkoutCreated()
 
 void JournalContentArea::onWorkoutEditRequested()
 {
+    flushPendingNavigation();
     // Switch to workout builder for editing
-    m_workoutBuilder->setDate(m_dateManager->currentDate());
+    workoutBuilder()->setDate(m_dateManager->currentDate());
     
     // Load existing workout data for editing
     QList<Workout> workouts = m_dataManager->getWorkoutsByDate(m_dateManager->currentDate());
-    m_workoutBuilder->loadWorkoutData(workouts);
+    workoutBuilder()->loadWorkoutData(workouts);
     
     m_workoutStackedWidget->setCurrentIndex(2);
 }
@@ -259,28 +413,11 @@ void JournalContentArea::onWorkoutCancelled()
     m_workoutStackedWidget->setCurrentIndex(1);
 }
 
-void JournalContentArea::onExerciseAdded()
-{
-    // Refresh workout builder with new exercises
-    m_workoutBuilder->updateExerciseComboBox();
-}
-
-void JournalContentArea::onExerciseUpdated()
-{
-    // Refresh workout builder with updated exercises
-    m_workoutBuilder->updateExerciseComboBox();
-}
-
-void JournalContentArea::onExerciseDeleted()
-{
-    // Refresh workout builder with updated exercises
-    m_workoutBuilder->updateExerciseComboBox();
-}
-
 void JournalContentArea::onAddWorkoutClicked()
 {
-    m_workoutBuilder->setDate(m_dateManager->currentDate());
-    m_workoutBuilder->clearForm();
+    flushPendingNavigation();
+    workoutBuilder()->setDate(m_dateManager->currentDate());
+    workoutBuilder()->clearForm();
     m_workoutStackedWidget->setCurrentIndex(2);
 }
 
@@ -351,6 +488,8 @@ void JournalContentArea::switchToVisualizations()
 
 void JournalContentArea::onEditShortcut()
 {
+    flushPendingNavigation();
+    
     int currentTab = m_tabWidget->currentIndex();
     
     if (currentTab == 0) { // Body Composition tab
@@ -368,6 +507,8 @@ void JournalContentArea::onEditShortcut()
 
 void JournalContentArea::onDeleteShortcut()
 {
+    flushPendingNavigation();
+    
     int currentTab = m_tabWidget->currentIndex();
     
     if (currentTab == 0) { // Body Composition tab
@@ -385,6 +526,8 @@ void JournalContentArea::onDeleteShortcut()
 
 void JournalContentArea::onAddShortcut()
 {
+    flushPendingNavigation();
+    
     int currentTab = m_tabWidget->currentIndex();
     
     if (currentTab == 0) { // Body Composition tab
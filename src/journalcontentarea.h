@@ -7,21 +7,30 @@
 #include <QStackedWidget>
 #include <QPushButton>
 #include <QTabWidget>
+#include <QTimer>
 #include "datemanager.h"
 #include "bodycompositionform.h"
 #include "bodycompositionview.h"
-#include "workoutbuilder.h"
 #include "workoutview.h"
-#include "exerciselibrary.h"
-#include "analyticstab.h"
 #include "models/datamanager.h"
 
+class WorkoutBuilder;
+class ExerciseLibrary;
+class AnalyticsTab;
+
 class JournalContentArea : public QWidget
 {
     Q_OBJECT
 
 public:
     explicit JournalContentArea(DateManager *dateManager, ::DataManager *dataManager, QWidget *parent = nullptr);
+    
+    // Renders a navigation burst's final date now instead of when it settles
+    void flushPendingNavigation();
+
+public slots:
+    void switchToBodyComposition();
+    void switchToWorkouts();
 
 private slots:
     void onDateChanged(const QDate &newDate);
@@ -34,12 +43,7 @@ private slots:
     void onWorkoutEditRequested();
     void onWorkoutDeleteRequested();
     void onWorkoutCancelled();
-    void onExerciseAdded();
-    void onExerciseUpdated();
-    void onExerciseDeleted();
     void setupKeyboardShortcuts();
-    void switchToBodyComposition();
-    void switchToWorkouts();
     void switchToExerciseLibrary();
     void switchToVisualizations();
     void onAddWorkoutClicked();
@@ -49,6 +53,13 @@ private slots:
     void onTodayShortcut();
     void onNextDayShortcut();
     void onPrevDayShortcut();
+    void onNavigationSettled();
+    void prefetchAdjacentDays();
+    void onTabChanged(int index);
+    void warmUpNextTab();
+
+protected:
+    void showEvent(QShowEvent *event) override;
 
 private:
     void setupUI();
@@ -57,6 +68,12 @@ private:
     void showBodyCompositionForm();
     void showBodyCompositionView(const BodyComposition &data);
     void loadDataForCurrentDate();
+    
+    // Heavy tabs are built on first use or by the idle warm-up
+    WorkoutBuilder *workoutBuilder();
+    ExerciseLibrary *exerciseLibrary();
+    AnalyticsTab *analyticsTab();
+    QWidget *createTabPage();
 
     DateManager *m_dateManager;
     ::DataManager *m_dataManager;
@@ -74,6 +91,15 @@ private:
     WorkoutView *m_workoutView;
     ExerciseLibrary *m_exerciseLibrary;
     AnalyticsTab *m_analyticsTab;
+    QWidget *m_exerciseLibraryPage;
+    QWidget *m_analyticsPage;
+    QTimer *m_warmUpTimer;
+    
+    // Date navigation: the first change of a burst renders at once, the
+    // rest collapse into one render when the burst settles
+    QTimer *m_navigationTimer;
+    QTimer *m_prefetchTimer;
+    bool m_navigationPending;
 };
 
 #endif // JOURNALCONTENTAREA_H 
\ No newline at end of file
@@ -1,22 +1,80 @@
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QStandardPaths>
 #include <QStyleFactory>
 #include "mainwindow.h"
+#include "stallwatchdog.h"
+#include "startuptimer.h"
+#include "utils/logging.h"
+#include "utils/trace.h"
 
 int main(int argc, char *argv[])
 {
+    StartupTimer::start();
     QApplication app(argc, argv);
+    StartupTimer::mark("application");
     
     // Set application properties
     app.setApplicationName("Fitness Tracker");
     app.setApplicationVersion("0.1.0");
     app.setOrganizationName("Fitness Tracker");
     
+    // Command line options
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption verboseOption(QStringList() << "verbose",
+                                     "Enable debug logging for all fitness.* categories.");
+    parser.addOption(verboseOption);
+    QCommandLineOption traceOption(QStringList() << "trace",
+                                   "Record trace spans and write them as Chrome trace JSON to <file> on exit.",
+                                   "file");
+    parser.addOption(traceOption);
+    QCommandLineOption stallOption(QStringList() << "stall-threshold",
+                                   "Log UI stalls longer than <ms> milliseconds (default 500, 0 disables).",
+                                   "ms", "500");
+    parser.addOption(stallOption);
+    parser.process(app);
+    
+    if (parser.isSet(verboseOption)) {
+        Logging::setVerbose(true);
+    }
+    QString tracePath = parser.value(traceOption);
+    if (!tracePath.isEmpty()) {
+        Trace::setEnabled(true);
+    }
+    
     // Use system theme
     app.setStyle(QStyleFactory::create("Fusion"));
     
     // Create and show main window
     MainWindow window;
+    StartupTimer::markFirstPaint(&window);
     window.show();
+    StartupTimer::mark("window shown");
+    
+    // Stalls are logged next to the data file
+    StallWatchdog *watchdog = nullptr;
+    int stallThreshold = parser.value(stallOption).toInt();
+    if (stallThreshold > 0) {
+        QString logPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)
+                          + "/fitness-tracker/stalls.log";
+        watchdog = new StallWatchdog(stallThreshold, logPath, &app);
+        watchdog->start();
+    }
+    
+    int result = app.exec();
+    if (watchdog) {
+        watchdog->stop();
+    }
+    
+    if (!tracePath.isEmpty()) {
+        if (Trace::writeChromeJson(tracePath)) {
+            qCInfo(lcStartup) << "Trace written to" << tracePath;
+        } else {
+            qCWarning(lcStartup) << "Failed to write trace to" << tracePath;
+        }
+    }
     
-    return app.exec();
+    return result;
 } 
\ No newline at end of file
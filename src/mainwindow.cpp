@@ -1,4 +1,9 @@
 #include "mainwindow.h"
+#include "notessearchpanel.h"
+#include "diagnosticsdialog.h"
+#include "startuptimer.h"
+#include "utils/logging.h"
+#include "utils/trace.h"
 #include <QApplication>
 #include <QVBoxLayout>
 #include <QWidget>
@@ -9,14 +14,22 @@
 #include <QShortcut>
 #include <QLineEdit>
 #include <QTextEdit>
+#include <QFileDialog>
+#include <QMessageBox>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , m_dateManager(new DateManager(this))
     , m_dataManager(new ::DataManager(this))
+    , m_notesSearchDock(nullptr)
+    , m_notesSearchPanel(nullptr)
+    , m_diagnosticsDialog(nullptr)
 {
+    StartupTimer::mark("data loaded");
+    
     setupUI();
     setupMenuBar();
+    StartupTimer::mark("main window built");
     
     // Set window properties
     setWindowTitle("Fitness Tracker");
@@ -56,6 +69,24 @@ void MainWindow::setupUI()
     // Add to layout
     mainLayout->addWidget(m_dateNavigationBar);
     mainLayout->addWidget(m_journalContentArea, 1); // Give content area more space
+    
+    // Notes search, docked on the side and hidden until requested
+    m_notesSearchPanel = new NotesSearchPanel(m_dataManager);
+    m_notesSearchDock = new QDockWidget("Search Notes", this);
+    m_notesSearchDock->setWidget(m_notesSearchPanel);
+    m_notesSearchDock->hide();
+    addDockWidget(Qt::RightDockWidgetArea, m_notesSearchDock);
+    connect(m_notesSearchPanel, &NotesSearchPanel::matchActivated, this, &MainWindow::onNotesMatchActivated);
+}
+
+void MainWindow::onNotesMatchActivated(const QDate &date, NotesIndex::Source source)
+{
+    m_dateManager->setCurrentDate(date);
+    if (source == NotesIndex::BodyCompositionNote) {
+        m_journalContentArea->switchToBodyComposition();
+    } else {
+        m_journalContentArea->switchToWorkouts();
+    }
 }
 
 void MainWindow::setupMenuBar()
@@ -67,8 +98,58 @@ void MainWindow::setupMenuBar()
     QAction *exitAction = fileMenu->addAction("E&xit");
     connect(exitAction, &QAction::triggered, this, &QWidget::close);
     
+    // Search menu
+    QMenu *searchMenu = menuBar->addMenu("&Search");
+    QAction *searchNotesAction = searchMenu->addAction("Search &Notes...");
+    searchNotesAction->setShortcut(QKeySequence::Find);
+    connect(searchNotesAction, &QAction::triggered, this, [this]() {
+        m_notesSearchDock->show();
+        m_notesSearchDock->raise();
+        m_notesSearchPanel->focusSearch();
+    });
+    
     // Help menu
     QMenu *helpMenu = menuBar->addMenu("&Help");
+    QAction *verboseAction = helpMenu->addAction("&Verbose Logging");
+    verboseAction->setCheckable(true);
+    verboseAction->setChecked(Logging::isVerbose());
+    verboseAction->setEnabled(Logging::debugOutputAvailable());
+    connect(verboseAction, &QAction::toggled, this, [](bool checked) {
+        Logging::setVerbose(checked);
+    });
+    
+    // Developer panel with live latency percentiles, available in Release too
+    QAction *diagnosticsAction = helpMenu->addAction("Performance &Diagnostics...");
+    diagnosticsAction->setShortcut(QKeySequence("Ctrl+Shift+D"));
+    connect(diagnosticsAction, &QAction::triggered, this, [this]() {
+        if (!m_diagnosticsDialog) {
+            m_diagnosticsDialog = new DiagnosticsDialog(m_dataManager, this);
+        }
+        m_diagnosticsDialog->show();
+        m_diagnosticsDialog->raise();
+        m_diagnosticsDialog->activateWindow();
+    });
+    
+    // Checking starts a fresh recording; unchecking asks where to save it
+    QAction *traceAction = helpMenu->addAction("Record &Trace");
+    traceAction->setCheckable(true);
+    traceAction->setChecked(Trace::isEnabled());
+    connect(traceAction, &QAction::toggled, this, [this](bool checked) {
+        if (checked) {
+            Trace::clear();
+            Trace::setEnabled(true);
+            return;
+        }
+        
+        Trace::setEnabled(false);
+        QString path = QFileDialog::getSaveFileName(this, "Save Trace", "fitness-trace.json",
+                                                    "Chrome trace (*.json)");
+        if (!path.isEmpty() && !Trace::writeChromeJson(path)) {
+            QMessageBox::warning(this, "Save Trace", QString("Could not write %1").arg(path));
+        }
+    });
+    helpMenu->addSeparator();
+    
     QAction *aboutAction = helpMenu->addAction("&About");
     // TODO: Add about dialog
 } 
\ No newline at end of file
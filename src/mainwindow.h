@@ -3,11 +3,15 @@
 
 #include <QMainWindow>
 #include <QVBoxLayout>
+#include <QDockWidget>
 #include "datemanager.h"
 #include "datenavigationbar.h"
 #include "journalcontentarea.h"
 #include "models/datamanager.h"
 
+class NotesSearchPanel;
+class DiagnosticsDialog;
+
 class MainWindow : public QMainWindow
 {
     Q_OBJECT
@@ -18,11 +22,15 @@ public:
 private:
     void setupUI();
     void setupMenuBar();
+    void onNotesMatchActivated(const QDate &date, NotesIndex::Source source);
 
     DateManager *m_dateManager;
     ::DataManager *m_dataManager;
     DateNavigationBar *m_dateNavigationBar;
     JournalContentArea *m_journalContentArea;
+    QDockWidget *m_notesSearchDock;
+    NotesSearchPanel *m_notesSearchPanel;
+    DiagnosticsDialog *m_diagnosticsDialog;
 };
 
 #endif // MAINWINDOW_H 
\ No newline at end of file
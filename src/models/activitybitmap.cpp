@@ -0,0 +1,239 @@
+#include "activitybitmap.h"
+#include <QtAlgorithms>
+
+namespace {
+// Bits [from, to] of a word set, 0 <= from <= to <= 63
+inline quint64 bitRange(int from, int to)
+{
+    quint64 upper = to == 63 ? ~0ULL : ((1ULL << (to + 1)) - 1);
+    return upper & ~((1ULL << from) - 1);
+}
+
+// Floor division for Julian days before the epoch
+inline qint64 floorDiv64(qint64 value)
+{
+    return value >= 0 ? value / 64 : -((-value + 63) / 64);
+}
+}
+
+void ActivityBitmap::set(Kind kind, const QDate &date, bool active)
+{
+    if (!date.isValid()) {
+        return;
+    }
+
+    qint64 day = date.toJulianDay();
+    if (active) {
+        ensureCovers(day);
+    } else if (m_words[0].isEmpty() || day < m_baseDay || day >= dayOf(m_words[0].size(), 0)) {
+        return;
+    }
+
+    qint64 offset = day - m_baseDay;
+    quint64 mask = 1ULL << (offset % 64);
+    quint64 &bits = m_words[indexOf(kind)][offset / 64];
+    bits = active ? (bits | mask) : (bits & ~mask);
+}
+
+void ActivityBitmap::clear(Kind kind)
+{
+    m_words[indexOf(kind)].fill(0);
+}
+
+void ActivityBitmap::clear()
+{
+    for (QList<quint64> &words : m_words) {
+        words.clear();
+    }
+    m_baseDay = 0;
+}
+
+bool ActivityBitmap::isActive(const QDate &date, Kinds kinds) const
+{
+    if (!date.isValid() || m_words[0].isEmpty()) {
+        return false;
+    }
+    qint64 offset = date.toJulianDay() - m_baseDay;
+    if (offset < 0 || offset >= m_words[0].size() * 64) {
+        return false;
+    }
+    return (word(offset / 64, kinds) >> (offset % 64)) & 1;
+}
+
+int ActivityBitmap::count(const QDate &start, const QDate &end, Kinds kinds) const
+{
+    if (m_words[0].isEmpty()) {
+        return 0;
+    }
+
+    qint64 first = qMax<qint64>(start.isValid() ? start.toJulianDay() - m_baseDay : 0, 0);
+    qint64 last = qMin<qint64>(end.isValid() ? end.toJulianDay() - m_baseDay : m_words[0].size() * 64 - 1,
+                               m_words[0].size() * 64 - 1);
+    if (first > last) {
+        return 0;
+    }
+
+    qsizetype firstWord = first / 64;
+    qsizetype lastWord = last / 64;
+    if (firstWord == lastWord) {
+        return qPopulationCount(word(firstWord, kinds) & bitRange(first % 64, last % 64));
+    }
+
+    int total = qPopulationCount(word(firstWord, kinds) & bitRange(first % 64, 63));
+    for (qsizetype i = firstWord + 1; i < lastWord; ++i) {
+        total += qPopulationCount(word(i, kinds));
+    }
+    total += qPopulationCount(word(lastWord, kinds) & bitRange(0, last % 64));
+    return total;
+}
+
+QDate ActivityBitmap::firstActiveDate(Kinds kinds) const
+{
+    for (qsizetype i = 0; i < m_words[0].size(); ++i) {
+        quint64 bits = word(i, kinds);
+        if (bits) {
+            return QDate::fromJulianDay(dayOf(i, qCountTrailingZeroBits(bits)));
+        }
+    }
+    return QDate();
+}
+
+QDate ActivityBitmap::lastActiveDate(Kinds kinds) const
+{
+    for (qsizetype i = m_words[0].size() - 1; i >= 0; --i) {
+        quint64 bits = word(i, kinds);
+        if (bits) {
+            return QDate::fromJulianDay(dayOf(i, 63 - qCountLeadingZeroBits(bits)));
+        }
+    }
+    return QDate();
+}
+
+ActivityBitmap::Streak ActivityBitmap::currentStreak(const QDate &today, Kinds kinds) const
+{
+    Streak streak;
+    if (!today.isValid() || m_words[0].isEmpty()) {
+        return streak;
+    }
+
+    // A streak isn't broken until the day is over
+    QDate end = isActive(today, kinds) ? today : today.addDays(-1);
+    qint64 offset = end.toJulianDay() - m_baseDay;
+    if (offset < 0 || offset >= m_words[0].size() * 64 || !isActive(end, kinds)) {
+        return streak;
+    }
+
+    // Walk backwards a word at a time: count the run of ones below the
+    // current bit with a leading-zero count on the inverted word
+    qsizetype index = offset / 64;
+    int bit = offset % 64;
+    int length = 0;
+    while (index >= 0) {
+        quint64 bits = word(index, kinds) << (63 - bit);    // current day now at bit 63
+        quint64 ones = ~bits;
+        int run = ones ? qCountLeadingZeroBits(ones) : 64;
+        run = qMin(run, bit + 1);
+        length += run;
+        if (run < bit + 1) {
+            break;
+        }
+        --index;
+        bit = 63;
+    }
+
+    streak.length = length;
+    streak.end = end;
+    streak.start = end.addDays(1 - length);
+    return streak;
+}
+
+ActivityBitmap::Streak ActivityBitmap::longestStreak(Kinds kinds) const
+{
+    Streak best;
+    qint64 runStart = -1;
+    int runLength = 0;
+
+    auto finishRun = [&]() {
+        if (runLength > best.length) {
+            best.length = runLength;
+            best.start = QDate::fromJulianDay(runStart);
+            best.end = QDate::fromJulianDay(runStart + runLength - 1);
+        }
+        runLength = 0;
+    };
+
+    // Visit runs of ones rather than individual days
+    for (qsizetype i = 0; i < m_words[0].size(); ++i) {
+        quint64 bits = word(i, kinds);
+        if (bits == ~0ULL) {
+            if (runLength == 0) {
+                runStart = dayOf(i, 0);
+            }
+            runLength += 64;
+            continue;
+        }
+
+        int position = 0;
+        while (position < 64) {
+            quint64 remaining = bits >> position;
+            if (remaining & 1) {
+                int ones = qCountTrailingZeroBits(~remaining);
+                ones = qMin(ones, 64 - position);
+                if (runLength == 0) {
+                    runStart = dayOf(i, position);
+                }
+                runLength += ones;
+                position += ones;
+            } else {
+                if (runLength > 0) {
+                    finishRun();
+                }
+                if (!remaining) {
+                    break;
+                }
+                position += qCountTrailingZeroBits(remaining);
+            }
+        }
+    }
+    finishRun();
+    return best;
+}
+
+quint64 ActivityBitmap::word(qsizetype index, Kinds kinds) const
+{
+    quint64 bits = 0;
+    if (kinds & BodyComposition) {
+        bits |= m_words[indexOf(BodyComposition)].at(index);
+    }
+    if (kinds & Workout) {
+        bits |= m_words[indexOf(Workout)].at(index);
+    }
+    return bits;
+}
+
+void ActivityBitmap::ensureCovers(qint64 julianDay)
+{
+    qint64 wordDay = floorDiv64(julianDay) * 64;
+    if (m_words[0].isEmpty()) {
+        m_baseDay = wordDay;
+        for (QList<quint64> &words : m_words) {
+            words.append(0);
+        }
+        return;
+    }
+
+    if (wordDay < m_baseDay) {
+        qsizetype missing = (m_baseDay - wordDay) / 64;
+        for (QList<quint64> &words : m_words) {
+            words.insert(0, missing, 0);
+        }
+        m_baseDay = wordDay;
+    }
+
+    qsizetype needed = (wordDay - m_baseDay) / 64 + 1;
+    for (QList<quint64> &words : m_words) {
+        if (words.size() < needed) {
+            words.resize(needed, 0);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef ACTIVITYBITMAP_H
+#define ACTIVITYBITMAP_H
+
+#include <QDate>
+#include <QFlags>
+#include <QList>
+
+// One bit per calendar day, keyed by Julian day, for each kind of logged
+// activity. Counts over a range are popcounts over 64-day words and streaks
+// are found by scanning runs of set bits, so years of history cost a few
+// hundred word operations instead of a lookup per date.
+class ActivityBitmap
+{
+public:
+    enum Kind {
+        BodyComposition = 0x1,
+        Workout = 0x2
+    };
+    Q_DECLARE_FLAGS(Kinds, Kind)
+
+    struct Streak {
+        int length = 0;
+        QDate start;
+        QDate end;
+    };
+
+    // Maintenance
+    void set(Kind kind, const QDate &date, bool active);
+    void clear(Kind kind);
+    void clear();
+
+    // Queries; with several kinds a day counts when any of them is set
+    bool isActive(const QDate &date, Kinds kinds) const;
+    int count(const QDate &start, const QDate &end, Kinds kinds) const;
+    QDate firstActiveDate(Kinds kinds) const;
+    QDate lastActiveDate(Kinds kinds) const;
+
+    // The run ending on `today`, or yesterday when today isn't logged yet
+    Streak currentStreak(const QDate &today, Kinds kinds) const;
+    Streak longestStreak(Kinds kinds) const;
+
+private:
+    static const int KindCount = 2;
+    static int indexOf(Kind kind) { return kind == Workout ? 1 : 0; }
+
+    quint64 word(qsizetype index, Kinds kinds) const;
+    qint64 dayOf(qsizetype wordIndex, int bit) const { return m_baseDay + wordIndex * 64 + bit; }
+    void ensureCovers(qint64 julianDay);
+
+    qint64 m_baseDay = 0;                // Julian day of bit 0 of word 0; a multiple of 64
+    QList<quint64> m_words[KindCount];   // every kind spans the same days
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(ActivityBitmap::Kinds)
+
+#endif // ACTIVITYBITMAP_H
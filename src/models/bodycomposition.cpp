@@ -1,7 +1,7 @@
 #include "bodycomposition.h"
+#include "bodycompositionbatch.h"
 #include <QDebug>
 #include <QJsonDocument>
-#include <QtMath>
 
 BodyComposition::BodyComposition()
     : m_weight(0.0)
@@ -78,53 +78,16 @@ bool BodyComposition::isEmpty() const
 
 void BodyComposition::calculateBMI()
 {
-    if (m_height <= 0.0 || m_weight <= 0.0) {
-        m_bmi = 0.0;
-        return;
-    }
-    
-    // Convert inches to meters
-    double heightMeters = m_height * 0.0254;
-    
-    // Convert pounds to kg
-    double weightKg = m_weight * 0.453592;
-    
-    // Calculate BMI: weight (kg) / height (m)²
-    m_bmi = weightKg / (heightMeters * heightMeters);
+    // BMI: weight (kg) / height (m)², from pounds and inches
+    m_bmi = BodyCompositionBatch::bmiFor(m_weight, m_height);
 }
 
 void BodyComposition::calculateBodyFat()
 {
-    if (m_waistCircumference <= 0.0 || m_neckCircumference <= 0.0 || m_height <= 0.0) {
-        m_bodyFatPercentage = 0.0;
-        return;
-    }
-    
-    if (m_waistCircumference <= m_neckCircumference) {
-        m_bodyFatPercentage = 0.0; // Invalid measurements
-        return;
-    }
-    
-    if (m_isMale) {
-        // Male formula: 86.010 × log10(waist - neck) - 70.041 × log10(height) + 36.76
-        double waistNeckDiff = m_waistCircumference - m_neckCircumference;
-        if (waistNeckDiff <= 0.0) {
-            m_bodyFatPercentage = 0.0;
-            return;
-        }
-        
-        m_bodyFatPercentage = (86.010 * qLn(waistNeckDiff) / qLn(10.0)) - 
-                             (70.041 * qLn(m_height) / qLn(10.0)) + 36.76;
-        
-        // Ensure reasonable range (0-50%)
-        if (m_bodyFatPercentage < 0.0 || m_bodyFatPercentage > 50.0) {
-            m_bodyFatPercentage = 0.0;
-        }
-    } else {
-        // For females, we need hip measurement which we don't have
-        // For now, set to 0 for females
-        m_bodyFatPercentage = 0.0;
-    }
+    // Male formula: 86.010 × log10(waist - neck) - 70.041 × log10(height) + 36.76
+    // For females we need a hip measurement which we don't have, so it stays 0
+    m_bodyFatPercentage = BodyCompositionBatch::bodyFatFor(m_waistCircumference, m_neckCircumference,
+                                                           m_height, m_isMale);
 }
 
 QJsonObject BodyComposition::toJson() const
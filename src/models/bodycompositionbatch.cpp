@@ -0,0 +1,146 @@
+#include "bodycompositionbatch.h"
+#include "utils/parallel.h"
+#include <cstdint>
+#include <cstring>
+
+namespace {
+// weight (lbs) / height (in)^2 scaled to kg / m^2
+constexpr double kBmiFactor = 0.453592 / (0.0254 * 0.0254);
+
+// log10 expressed through the natural log below
+constexpr double kInvLn10 = 0.43429448190325182765;
+constexpr double kLn2 = 0.69314718055994530942;
+
+// Navy tape test (male): 86.010 * log10(waist - neck) - 70.041 * log10(height) + 36.76
+constexpr double kWaistNeckCoefficient = 86.010 * kInvLn10;
+constexpr double kHeightCoefficient = 70.041 * kInvLn10;
+constexpr double kBodyFatOffset = 36.76;
+
+// Natural log of a positive, normal x, within 2 ulp of std::log. Compilers
+// don't vectorize loops calling std::log without -ffast-math, so this one
+// is built from integer and multiply-add steps that do vectorize.
+inline double vectorLog(double x)
+{
+    // x = 2^k * m with m in [sqrt(1/2), sqrt(2)); e is k + 1023
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof bits);
+    std::uint64_t e = (bits - 0x3fe6a09e667f3bcdULL + 0x3ff0000000000000ULL) >> 52;
+    std::uint64_t mantissaBits = bits - ((e - 1023) << 52);
+    double m;
+    std::memcpy(&m, &mantissaBits, sizeof m);
+
+    // k as a double without an int64 conversion (none before AVX-512)
+    std::uint64_t exponentBits = 0x4330000000000000ULL | e;
+    double k;
+    std::memcpy(&k, &exponentBits, sizeof k);
+    k -= 4503599627370496.0 + 1023.0;
+
+    // log(m) = 2 atanh(s), s = (m - 1) / (m + 1), |s| < 0.172
+    double s = (m - 1.0) / (m + 1.0);
+    double z = s * s;
+    double series = 1.0 / 23;
+    series = series * z + 1.0 / 21;
+    series = series * z + 1.0 / 19;
+    series = series * z + 1.0 / 17;
+    series = series * z + 1.0 / 15;
+    series = series * z + 1.0 / 13;
+    series = series * z + 1.0 / 11;
+    series = series * z + 1.0 / 9;
+    series = series * z + 1.0 / 7;
+    series = series * z + 1.0 / 5;
+    series = series * z + 1.0 / 3;
+    series = series * z + 1.0;
+    return k * kLn2 + 2.0 * s * series;
+}
+}
+
+BodyCompositionBatch::BodyCompositionBatch()
+{
+}
+
+void BodyCompositionBatch::reserve(qsizetype size)
+{
+    m_weight.reserve(size);
+    m_waist.reserve(size);
+    m_height.reserve(size);
+    m_neck.reserve(size);
+    m_isMale.reserve(size);
+}
+
+void BodyCompositionBatch::append(const BodyComposition &composition)
+{
+    m_weight.append(composition.weight());
+    m_waist.append(composition.waistCircumference());
+    m_height.append(composition.height());
+    m_neck.append(composition.neckCircumference());
+    m_isMale.append(composition.isMale() ? 1 : 0);
+}
+
+void BodyCompositionBatch::compute()
+{
+    const qsizetype count = size();
+    m_bmi.resize(count);
+    m_bodyFat.resize(count);
+
+    const double *weight = m_weight.constData();
+    const double *waist = m_waist.constData();
+    const double *height = m_height.constData();
+    const double *neck = m_neck.constData();
+    const unsigned char *isMale = m_isMale.constData();
+    double *bmi = m_bmi.data();
+    double *bodyFat = m_bodyFat.data();
+
+    Parallel::forChunks(count, [=](qsizetype begin, qsizetype end) {
+        computeBMI(weight + begin, height + begin, bmi + begin, end - begin);
+        computeBodyFat(waist + begin, neck + begin, height + begin, isMale + begin, bodyFat + begin, end - begin);
+    });
+}
+
+void BodyCompositionBatch::computeBMI(const double *weight, const double *height, double *bmi, qsizetype count)
+{
+    for (qsizetype i = 0; i < count; ++i) {
+        double w = weight[i];
+        double h = height[i];
+        bool valid = (w > 0.0) & (h > 0.0);
+        double safeHeight = valid ? h : 1.0;
+        double value = w * kBmiFactor / (safeHeight * safeHeight);
+        bmi[i] = valid ? value : 0.0;
+    }
+}
+
+void BodyCompositionBatch::computeBodyFat(const double *waist, const double *neck, const double *height,
+                                          const unsigned char *isMale, double *bodyFat, qsizetype count)
+{
+    for (qsizetype i = 0; i < count; ++i) {
+        double h = height[i];
+        double difference = waist[i] - neck[i];
+
+        // Females need a hip measurement we don't have, so they stay at 0
+        bool valid = (waist[i] > 0.0) & (neck[i] > 0.0) & (h > 0.0) & (difference > 0.0) & (isMale[i] != 0);
+        double safeDifference = valid ? difference : 1.0;
+        double safeHeight = valid ? h : 1.0;
+
+        double value = kWaistNeckCoefficient * vectorLog(safeDifference)
+                     - kHeightCoefficient * vectorLog(safeHeight)
+                     + kBodyFatOffset;
+
+        // Ensure reasonable range (0-50%)
+        value = valid ? value : 0.0;
+        bodyFat[i] = (value >= 0.0) & (value <= 50.0) ? value : 0.0;
+    }
+}
+
+double BodyCompositionBatch::bmiFor(double weight, double height)
+{
+    double bmi = 0.0;
+    computeBMI(&weight, &height, &bmi, 1);
+    return bmi;
+}
+
+double BodyCompositionBatch::bodyFatFor(double waist, double neck, double height, bool isMale)
+{
+    unsigned char male = isMale ? 1 : 0;
+    double bodyFat = 0.0;
+    computeBodyFat(&waist, &neck, &height, &male, &bodyFat, 1);
+    return bodyFat;
+}
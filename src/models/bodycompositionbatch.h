@@ -0,0 +1,44 @@
+#ifndef BODYCOMPOSITIONBATCH_H
+#define BODYCOMPOSITIONBATCH_H
+
+#include <QList>
+#include "bodycomposition.h"
+
+// Column-oriented copy of body composition inputs used to re-derive BMI and
+// body fat for a whole history at once. The kernels work on flat arrays with
+// branch-free loops so the compiler can vectorize them, and compute() splits
+// the columns across worker threads.
+class BodyCompositionBatch
+{
+public:
+    BodyCompositionBatch();
+
+    void reserve(qsizetype size);
+    void append(const BodyComposition &composition);
+    qsizetype size() const { return m_weight.size(); }
+
+    void compute();
+
+    double bmi(qsizetype index) const { return m_bmi.at(index); }
+    double bodyFatPercentage(qsizetype index) const { return m_bodyFat.at(index); }
+
+    // Array kernels. Inputs use the same units as BodyComposition (lbs, inches).
+    static void computeBMI(const double *weight, const double *height, double *bmi, qsizetype count);
+    static void computeBodyFat(const double *waist, const double *neck, const double *height,
+                               const unsigned char *isMale, double *bodyFat, qsizetype count);
+
+    // Scalar forms shared with BodyComposition::calculateBMI/calculateBodyFat
+    static double bmiFor(double weight, double height);
+    static double bodyFatFor(double waist, double neck, double height, bool isMale);
+
+private:
+    QList<double> m_weight;
+    QList<double> m_waist;
+    QList<double> m_height;
+    QList<double> m_neck;
+    QList<unsigned char> m_isMale;
+    QList<double> m_bmi;
+    QList<double> m_bodyFat;
+};
+
+#endif // BODYCOMPOSITIONBATCH_H
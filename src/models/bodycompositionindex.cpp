@@ -0,0 +1,220 @@
+#include "bodycompositionindex.h"
+#include <QtAlgorithms>
+#include <algorithm>
+#include <limits>
+
+BodyCompositionIndex::BodyCompositionIndex()
+{
+    clear();
+}
+
+void BodyCompositionIndex::rebuild(const QMap<QDate, BodyComposition> &data)
+{
+    m_days.clear();
+    m_days.reserve(data.size());
+    for (Column &column : m_columns) {
+        column.values.clear();
+        column.values.reserve(data.size());
+    }
+
+    // QMap iterates in date order, so the columns come out sorted
+    for (auto it = data.constBegin(); it != data.constEnd(); ++it) {
+        m_days.append(it.key().toJulianDay());
+        for (int metric = 0; metric < MetricCount; ++metric) {
+            m_columns[metric].values.append(metricValue(it.value(), static_cast<Metric>(metric)));
+        }
+    }
+
+    rebuildFrom(0);
+}
+
+void BodyCompositionIndex::upsert(const BodyComposition &composition)
+{
+    if (!composition.date().isValid()) {
+        return;
+    }
+
+    qint64 day = composition.date().toJulianDay();
+    int position = std::lower_bound(m_days.constBegin(), m_days.constEnd(), day) - m_days.constBegin();
+    bool exists = position < m_days.size() && m_days.at(position) == day;
+
+    if (!exists) {
+        m_days.insert(position, day);
+    }
+
+    for (int metric = 0; metric < MetricCount; ++metric) {
+        double value = metricValue(composition, static_cast<Metric>(metric));
+        if (exists) {
+            m_columns[metric].values[position] = value;
+        } else {
+            m_columns[metric].values.insert(position, value);
+        }
+    }
+
+    rebuildFrom(position);
+}
+
+void BodyCompositionIndex::remove(const QDate &date)
+{
+    if (!date.isValid()) {
+        return;
+    }
+
+    qint64 day = date.toJulianDay();
+    int position = std::lower_bound(m_days.constBegin(), m_days.constEnd(), day) - m_days.constBegin();
+    if (position >= m_days.size() || m_days.at(position) != day) {
+        return;
+    }
+
+    m_days.removeAt(position);
+    for (Column &column : m_columns) {
+        column.values.removeAt(position);
+    }
+
+    rebuildFrom(position);
+}
+
+void BodyCompositionIndex::clear()
+{
+    m_days.clear();
+    for (Column &column : m_columns) {
+        column.values.clear();
+    }
+    rebuildFrom(0);
+}
+
+BodyCompositionIndex::RangeStats BodyCompositionIndex::stats(Metric metric, const QDate &start, const QDate &end) const
+{
+    RangeStats result;
+    if (metric < 0 || metric >= MetricCount) {
+        return result;
+    }
+
+    int lo = lowerIndex(start);
+    int hi = upperIndex(end);
+    if (lo >= hi) {
+        return result;
+    }
+
+    const Column &column = m_columns[metric];
+    int count = column.prefixCount.at(hi) - column.prefixCount.at(lo);
+    if (count == 0) {
+        return result;
+    }
+
+    double sum = column.prefixSum.at(hi) - column.prefixSum.at(lo);
+    double sumSquares = column.prefixSumSquares.at(hi) - column.prefixSumSquares.at(lo);
+
+    result.count = count;
+    result.mean = sum / count;
+    result.variance = qMax(0.0, sumSquares / count - result.mean * result.mean);
+
+    // Two overlapping power-of-two windows cover [lo, hi)
+    int level = floorLog2(hi - lo);
+    int span = 1 << level;
+    const QList<double> &minLevel = column.minTable.at(level);
+    const QList<double> &maxLevel = column.maxTable.at(level);
+    result.min = qMin(minLevel.at(lo), minLevel.at(hi - span));
+    result.max = qMax(maxLevel.at(lo), maxLevel.at(hi - span));
+
+    return result;
+}
+
+double BodyCompositionIndex::metricValue(const BodyComposition &composition, Metric metric)
+{
+    double value = 0.0;
+    switch (metric) {
+        case Weight: value = composition.weight(); break;
+        case BMI: value = composition.bmi(); break;
+        case BodyFat: value = composition.bodyFatPercentage(); break;
+        case Waist: value = composition.waistCircumference(); break;
+        default: break;
+    }
+    return value > 0.0 ? value : 0.0;
+}
+
+void BodyCompositionIndex::rebuildFrom(int position)
+{
+    for (Column &column : m_columns) {
+        rebuildColumnFrom(column, position);
+    }
+}
+
+void BodyCompositionIndex::rebuildColumnFrom(Column &column, int position)
+{
+    const int n = column.values.size();
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Prefix aggregates: entry i covers values [0, i)
+    column.prefixSum.resize(n + 1);
+    column.prefixSumSquares.resize(n + 1);
+    column.prefixCount.resize(n + 1);
+    column.prefixSum[0] = 0.0;
+    column.prefixSumSquares[0] = 0.0;
+    column.prefixCount[0] = 0;
+
+    for (int i = position; i < n; ++i) {
+        double value = column.values.at(i);
+        bool valid = value > 0.0;
+        column.prefixSum[i + 1] = column.prefixSum.at(i) + (valid ? value : 0.0);
+        column.prefixSumSquares[i + 1] = column.prefixSumSquares.at(i) + (valid ? value * value : 0.0);
+        column.prefixCount[i + 1] = column.prefixCount.at(i) + (valid ? 1 : 0);
+    }
+
+    // Sparse tables: level k, entry i covers values [i, i + 2^k)
+    int levels = n > 0 ? floorLog2(n) + 1 : 0;
+    column.minTable.resize(levels);
+    column.maxTable.resize(levels);
+    if (levels == 0) {
+        return;
+    }
+
+    column.minTable[0].resize(n);
+    column.maxTable[0].resize(n);
+    for (int i = position; i < n; ++i) {
+        double value = column.values.at(i);
+        bool valid = value > 0.0;
+        column.minTable[0][i] = valid ? value : infinity;
+        column.maxTable[0][i] = valid ? value : -infinity;
+    }
+
+    for (int level = 1; level < levels; ++level) {
+        int span = 1 << level;
+        int half = span >> 1;
+        int entries = n - span + 1;
+        QList<double> &minLevel = column.minTable[level];
+        QList<double> &maxLevel = column.maxTable[level];
+        const QList<double> &minBelow = column.minTable.at(level - 1);
+        const QList<double> &maxBelow = column.maxTable.at(level - 1);
+
+        minLevel.resize(entries);
+        maxLevel.resize(entries);
+
+        // Only windows reaching into [position, n) can have changed
+        for (int i = qMax(0, position - span + 1); i < entries; ++i) {
+            minLevel[i] = qMin(minBelow.at(i), minBelow.at(i + half));
+            maxLevel[i] = qMax(maxBelow.at(i), maxBelow.at(i + half));
+        }
+    }
+}
+
+int BodyCompositionIndex::lowerIndex(const QDate &start) const
+{
+    if (!start.isValid()) {
+        return 0;
+    }
+    return std::lower_bound(m_days.constBegin(), m_days.constEnd(), start.toJulianDay()) - m_days.constBegin();
+}
+
+int BodyCompositionIndex::upperIndex(const QDate &end) const
+{
+    if (!end.isValid()) {
+        return m_days.size();
+    }
+    return std::upper_bound(m_days.constBegin(), m_days.constEnd(), end.toJulianDay()) - m_days.constBegin();
+}
+
+int BodyCompositionIndex::floorLog2(int value)
+{
+    return 31 - static_cast<int>(qCountLeadingZeroBits(static_cast<quint32>(value)));
+}
@@ -0,0 +1,72 @@
+#ifndef BODYCOMPOSITIONINDEX_H
+#define BODYCOMPOSITIONINDEX_H
+
+#include <QDate>
+#include <QList>
+#include <QMap>
+#include "bodycomposition.h"
+
+// Aggregate index over the body composition timeline. Keeps prefix sums and
+// sums of squares (for mean/variance) plus sparse tables (for min/max) per
+// metric, so any date-range statistic is answered in O(log n) for the date
+// lookup and O(1) for the aggregate itself.
+//
+// Appending a new latest entry costs O(log n). Editing or removing an older
+// entry rebuilds the tables from that position forward.
+class BodyCompositionIndex
+{
+public:
+    enum Metric {
+        Weight,
+        BMI,
+        BodyFat,
+        Waist,
+        MetricCount
+    };
+
+    struct RangeStats {
+        int count = 0;
+        double mean = 0.0;
+        double variance = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+
+        bool isEmpty() const { return count == 0; }
+    };
+
+    BodyCompositionIndex();
+
+    // Maintenance
+    void rebuild(const QMap<QDate, BodyComposition> &data);
+    void upsert(const BodyComposition &composition);
+    void remove(const QDate &date);
+    void clear();
+
+    // Queries. An invalid start or end date leaves that side of the range open.
+    int size() const { return m_days.size(); }
+    RangeStats stats(Metric metric, const QDate &start = QDate(), const QDate &end = QDate()) const;
+
+    // Only positive values count as measurements
+    static double metricValue(const BodyComposition &composition, Metric metric);
+
+private:
+    struct Column {
+        QList<double> values;
+        QList<double> prefixSum;
+        QList<double> prefixSumSquares;
+        QList<int> prefixCount;
+        QList<QList<double>> minTable;
+        QList<QList<double>> maxTable;
+    };
+
+    void rebuildFrom(int position);
+    void rebuildColumnFrom(Column &column, int position);
+    int lowerIndex(const QDate &start) const;
+    int upperIndex(const QDate &end) const;
+    static int floorLog2(int value);
+
+    QList<qint64> m_days;
+    Column m_columns[MetricCount];
+};
+
+#endif // BODYCOMPOSITIONINDEX_H
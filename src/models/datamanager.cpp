@@ -1,6 +1,11 @@
 #include "datamanager.h"
+#include "bodycompositionbatch.h"
+#include "utils/logging.h"
+#include "utils/latencyhistogram.h"
+#include "utils/trace.h"
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -8,13 +13,21 @@
 #include <QDebug>
 #include <algorithm>
 #include <limits>
-#include <cstdio>
 
 DataManager::DataManager(QObject *parent)
+    : DataManager(QString(), parent)
+{
+}
+
+DataManager::DataManager(const QString &dataFilePath, QObject *parent)
     : QObject(parent)
+    , m_weightTrend(BodyCompositionIndex::Weight)
+    , m_bodyFatTrend(BodyCompositionIndex::BodyFat)
+    , m_personalRecords(&m_strengthIndex)
+    , m_trainingLoad(&m_strengthIndex)
 {
-    m_dataFilePath = getDataFilePath();
-    printf("DataManager: Looking for data file at: %s\n", m_dataFilePath.toLocal8Bit().data());
+    m_dataFilePath = dataFilePath.isEmpty() ? getDataFilePath() : dataFilePath;
+    qCInfo(lcData) << "Data file:" << m_dataFilePath;
     ensureDataDirectory();
     loadData();
 }
@@ -22,6 +35,11 @@ DataManager::DataManager(QObject *parent)
 bool DataManager::saveBodyComposition(const BodyComposition &data)
 {
     m_bodyCompositionData[data.date()] = data;
+    m_bodyCompositionIndex.upsert(data);
+    m_weightTrend.upsert(data);
+    m_bodyFatTrend.upsert(data);
+    m_activity.set(ActivityBitmap::BodyComposition, data.date(), true);
+    m_notesIndex.addBodyComposition(data);
     bool success = saveData();
     if (success) {
         emit dataChanged();
@@ -42,6 +60,11 @@ bool DataManager::hasBodyComposition(const QDate &date) const
 void DataManager::deleteBodyComposition(const QDate &date)
 {
     if (m_bodyCompositionData.remove(date) > 0) {
+        m_bodyCompositionIndex.remove(date);
+        m_weightTrend.remove(date);
+        m_bodyFatTrend.remove(date);
+        m_activity.set(ActivityBitmap::BodyComposition, date, false);
+        m_notesIndex.removeBodyComposition(date);
         saveData();
         emit dataChanged();
     }
@@ -84,27 +107,100 @@ QList<BodyComposition> DataManager::getAllBodyCompositionSorted() const
 
 QPair<double, double> DataManager::getWeightRange() const
 {
-    if (m_bodyCompositionData.isEmpty()) {
+    // Only valid (positive) weights are indexed; no entries gives 0,0
+    BodyCompositionIndex::RangeStats weights = m_bodyCompositionIndex.stats(BodyCompositionIndex::Weight);
+    if (weights.isEmpty()) {
         return QPair<double, double>(0.0, 0.0);
     }
     
-    double minWeight = std::numeric_limits<double>::max();
-    double maxWeight = std::numeric_limits<double>::lowest();
+    return QPair<double, double>(weights.min, weights.max);
+}
+
+BodyCompositionIndex::RangeStats DataManager::getBodyCompositionStats(BodyCompositionIndex::Metric metric,
+                                                                      const QDate &start,
+                                                                      const QDate &end) const
+{
+    return m_bodyCompositionIndex.stats(metric, start, end);
+}
+
+QList<TrendFilter::Point> DataManager::getTrendPoints(BodyCompositionIndex::Metric metric,
+                                                      const QDate &start,
+                                                      const QDate &end) const
+{
+    switch (metric) {
+        case BodyCompositionIndex::Weight: return m_weightTrend.points(start, end);
+        case BodyCompositionIndex::BodyFat: return m_bodyFatTrend.points(start, end);
+        default: return QList<TrendFilter::Point>();
+    }
+}
+
+GoalProjection::Result DataManager::projectGoal(BodyCompositionIndex::Metric metric, double goal) const
+{
+    // Fit on the recent past only; older phases (bulking, cutting) would
+    // blur the current rate of change
+    const int fitWindowDays = 180;
     
-    for (const BodyComposition &composition : m_bodyCompositionData.values()) {
-        double weight = composition.weight();
-        if (weight > 0) { // Only consider valid weights
-            minWeight = qMin(minWeight, weight);
-            maxWeight = qMax(maxWeight, weight);
-        }
+    if (m_bodyCompositionData.isEmpty()) {
+        return GoalProjection::Result();
+    }
+    QDate lastDate = m_bodyCompositionData.lastKey();
+    QList<TrendFilter::Point> points = getTrendPoints(metric, lastDate.addDays(-fitWindowDays), lastDate);
+    if (points.isEmpty()) {
+        return GoalProjection::Result();
     }
     
-    // If no valid weights found, return 0,0
-    if (minWeight == std::numeric_limits<double>::max()) {
-        return QPair<double, double>(0.0, 0.0);
+    QList<QPair<QDate, double>> history;
+    history.reserve(points.size());
+    for (const TrendFilter::Point &point : points) {
+        history.append(qMakePair(point.date, point.value));
     }
     
-    return QPair<double, double>(minWeight, maxWeight);
+    // Start from the filtered estimate rather than the last, noisy reading
+    const TrendFilter::Point &latest = points.last();
+    return GoalProjection::project(GoalProjection::fit(history), latest.date, latest.kalman, goal);
+}
+
+bool DataManager::recomputeDerivedMetrics()
+{
+    if (m_bodyCompositionData.isEmpty()) {
+        return true;
+    }
+    
+    // Gather inputs column-wise, derive everything in one parallel pass, scatter back
+    BodyCompositionBatch batch;
+    batch.reserve(m_bodyCompositionData.size());
+    for (auto it = m_bodyCompositionData.constBegin(); it != m_bodyCompositionData.constEnd(); ++it) {
+        batch.append(it.value());
+    }
+    
+    batch.compute();
+    
+    qsizetype row = 0;
+    for (auto it = m_bodyCompositionData.begin(); it != m_bodyCompositionData.end(); ++it, ++row) {
+        it.value().setBMI(batch.bmi(row));
+        it.value().setBodyFatPercentage(batch.bodyFatPercentage(row));
+    }
+    
+    rebuildBodyCompositionIndexes();
+    bool success = saveData();
+    if (success) {
+        emit dataChanged();
+    }
+    return success;
+}
+
+bool DataManager::applyProfileCorrection(double height, bool isMale)
+{
+    if (height <= 0.0 || height > 300.0) {
+        return false;
+    }
+    
+    for (auto it = m_bodyCompositionData.begin(); it != m_bodyCompositionData.end(); ++it) {
+        it.value().setHeight(height);
+        it.value().setIsMale(isMale);
+    }
+    
+    return recomputeDerivedMetrics();
 }
 
 QPair<QDate, QDate> DataManager::getDataDateRange() const
@@ -121,23 +217,23 @@ QPair<QDate, QDate> DataManager::getDataDateRange() const
 
 bool DataManager::loadData()
 {
+    TRACE_SCOPE("DataManager::loadData");
+    LatencyScope latency(Latency::Load);
     QFile file(m_dataFilePath);
-    qDebug() << "DataManager::loadData: Checking file:" << m_dataFilePath;
-    qDebug() << "DataManager::loadData: File exists:" << file.exists();
     if (!file.exists()) {
-        qDebug() << "DataManager::loadData: No data file found, that's okay";
+        qCDebug(lcData) << "loadData: no data file at" << m_dataFilePath;
         return true; // No data file yet, that's okay
     }
     
     if (!file.open(QIODevice::ReadOnly)) {
-        qWarning() << "Failed to open data file for reading:" << m_dataFilePath;
+        qCWarning(lcData) << "Failed to open data file for reading:" << m_dataFilePath;
         return false;
     }
     
     QJsonParseError error;
     QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
     if (error.error != QJsonParseError::NoError) {
-        qWarning() << "Failed to parse data file:" << error.errorString();
+        qCWarning(lcData) << "Failed to parse data file:" << error.errorString();
         return false;
     }
     
@@ -145,20 +241,21 @@ bool DataManager::loadData()
     if (root.contains("bodyComposition")) {
         QJsonArray array = root["bodyComposition"].toArray();
         m_bodyCompositionData.clear();
-        qDebug() << "DataManager::loadData: Found" << array.size() << "body composition entries in JSON";
+        qCDebug(lcData) << "loadData:" << array.size() << "body composition entries in JSON";
         
         for (const QJsonValue &value : array) {
             QJsonObject obj = value.toObject();
             BodyComposition composition = BodyComposition::fromJson(obj);
             if (composition.date().isValid()) {
                 m_bodyCompositionData[composition.date()] = composition;
-                qDebug() << "  Loaded entry for date:" << composition.date().toString() 
-                         << "Weight:" << composition.weight() << "BMI:" << composition.bmi();
+                qCDebug(lcData) << "  loaded" << composition.date()
+                                << "weight" << composition.weight() << "bmi" << composition.bmi();
             } else {
-                qDebug() << "  Skipped entry with invalid date:" << obj["date"].toString();
+                qCWarning(lcData) << "Skipped body composition entry with invalid date:" << obj["date"].toString();
             }
         }
-        qDebug() << "DataManager::loadData: Total loaded entries:" << m_bodyCompositionData.size();
+        qCDebug(lcData) << "loadData:" << m_bodyCompositionData.size() << "body composition entries loaded";
+        rebuildBodyCompositionIndexes();
     }
     
     // Load exercises
@@ -173,6 +270,8 @@ bool DataManager::loadData()
                 m_exercises[exercise.id()] = exercise;
             }
         }
+        m_exerciseModel.reset(m_exercises);
+        m_exerciseSearch.rebuild(m_exercises);
     }
     
     // Load workouts
@@ -188,15 +287,18 @@ bool DataManager::loadData()
             }
         }
     }
+    rebuildWorkoutIndexes();
     
     return true;
 }
 
 bool DataManager::saveData()
 {
+    TRACE_SCOPE("DataManager::saveData");
+    LatencyScope latency(Latency::Save);
     QFile file(m_dataFilePath);
     if (!file.open(QIODevice::WriteOnly)) {
-        qWarning() << "Failed to open data file for writing:" << m_dataFilePath;
+        qCWarning(lcData) << "Failed to open data file for writing:" << m_dataFilePath;
         return false;
     }
     
@@ -227,7 +329,7 @@ bool DataManager::saveData()
     qint64 bytesWritten = file.write(doc.toJson());
     
     if (bytesWritten == -1) {
-        qWarning() << "Failed to write data file";
+        qCWarning(lcData) << "Failed to write data file";
         return false;
     }
     
@@ -240,15 +342,12 @@ QString DataManager::getDataFilePath() const
     QString standardPath = appDataPath + "/fitness-tracker/data.json";
     QString actualPath = "/home/paul/.local/share/Fitness Tracker/Fitness Tracker/fitness-tracker/data.json";
     
-    printf("Standard path would be: %s\n", standardPath.toLocal8Bit().data());
-    printf("Actual data file is at: %s\n", actualPath.toLocal8Bit().data());
+    qCDebug(lcData) << "Standard path:" << standardPath << "actual path:" << actualPath;
     
     // Check if data exists at the actual location
     if (QFile::exists(actualPath)) {
-        printf("Using actual data file location\n");
         return actualPath;
     } else {
-        printf("Using standard path (no data at actual location)\n");
         return standardPath;
     }
 }
@@ -261,6 +360,20 @@ void DataManager::ensureDataDirectory() const
     }
 }
 
+void DataManager::rebuildBodyCompositionIndexes()
+{
+    m_bodyCompositionIndex.rebuild(m_bodyCompositionData);
+    m_weightTrend.rebuild(m_bodyCompositionData);
+    m_bodyFatTrend.rebuild(m_bodyCompositionData);
+    
+    m_activity.clear(ActivityBitmap::BodyComposition);
+    m_notesIndex.clearBodyComposition();
+    for (auto it = m_bodyCompositionData.constBegin(); it != m_bodyCompositionData.constEnd(); ++it) {
+        m_activity.set(ActivityBitmap::BodyComposition, it.key(), true);
+        m_notesIndex.addBodyComposition(it.value());
+    }
+}
+
 // Exercise management methods
 bool DataManager::saveExercise(const Exercise &exercise)
 {
@@ -273,7 +386,22 @@ bool DataManager::saveExercise(const Exercise &exercise)
         exerciseToSave.setId(getNextExerciseId());
     }
     
+    // Volume rollups bucket by category, so recategorizing an exercise that
+    // has logged sets means re-bucketing the history; new ones have none
+    auto previous = m_exercises.constFind(exerciseToSave.id());
+    bool rebucket = previous != m_exercises.constEnd()
+                    && previous.value().category() != exerciseToSave.category()
+                    && m_strengthIndex.hasSessions(exerciseToSave.id());
+    
     m_exercises[exerciseToSave.id()] = exerciseToSave;
+    m_exerciseModel.upsert(exerciseToSave);
+    m_exerciseSearch.addExercise(exerciseToSave);
+    
+    m_volumeRollup.setCategory(exerciseToSave.id(), exerciseToSave.category());
+    if (rebucket) {
+        m_volumeRollup.rebuild(m_workouts);
+    }
+    
     bool success = saveData();
     if (success) {
         emit dataChanged();
@@ -305,6 +433,15 @@ QList<Exercise> DataManager::getExercisesByCategory(const QString &category) con
 bool DataManager::deleteExercise(int id)
 {
     if (m_exercises.remove(id) > 0) {
+        m_exerciseModel.remove(id);
+        m_exerciseSearch.removeExercise(id);
+        
+        // Logged sets of a deleted exercise count as Uncategorized, as they
+        // will after the next load
+        m_volumeRollup.removeCategory(id);
+        if (m_strengthIndex.hasSessions(id)) {
+            m_volumeRollup.rebuild(m_workouts);
+        }
         saveData();
         emit dataChanged();
         return true;
@@ -312,6 +449,11 @@ bool DataManager::deleteExercise(int id)
     return false;
 }
 
+QList<ExerciseSearchIndex::Match> DataManager::searchExercises(const QString &query, int limit, bool activeOnly) const
+{
+    return m_exerciseSearch.search(query, limit, activeOnly);
+}
+
 int DataManager::getNextExerciseId() const
 {
     int maxId = 0;
@@ -322,7 +464,7 @@ int DataManager::getNextExerciseId() const
 }
 
 // Workout management methods
-bool DataManager::saveWorkout(const Workout &workout)
+bool DataManager::saveWorkout(const Workout &workout, int *savedId)
 {
     if (!workout.isValid()) {
         return false;
@@ -333,7 +475,17 @@ bool DataManager::saveWorkout(const Workout &workout)
         workoutToSave.setId(getNextWorkoutId());
     }
     
+    // Replace any previous version of this workout in the strength indexes
+    auto existing = m_workouts.constFind(workoutToSave.id());
+    if (existing != m_workouts.constEnd()) {
+        unindexWorkout(existing.value());
+    }
+    
     m_workouts[workoutToSave.id()] = workoutToSave;
+    if (savedId) {
+        *savedId = workoutToSave.id();
+    }
+    indexWorkout(workoutToSave);
     bool success = saveData();
     if (success) {
         emit dataChanged();
@@ -353,17 +505,25 @@ QList<Workout> DataManager::getAllWorkouts() const
 
 QList<Workout> DataManager::getWorkoutsByDate(const QDate &date) const
 {
+    // Date index instead of a scan; keep the id order callers are used to
+    QList<int> ids = m_workoutsByDate.values(date);
+    std::sort(ids.begin(), ids.end());
+    
     QList<Workout> filtered;
-    for (const Workout &workout : m_workouts.values()) {
-        if (workout.date() == date) {
-            filtered.append(workout);
-        }
+    filtered.reserve(ids.size());
+    for (int id : ids) {
+        filtered.append(m_workouts.value(id));
     }
     return filtered;
 }
 
 bool DataManager::deleteWorkout(int id)
 {
+    auto existing = m_workouts.constFind(id);
+    if (existing != m_workouts.constEnd()) {
+        unindexWorkout(existing.value());
+    }
+    
     if (m_workouts.remove(id) > 0) {
         saveData();
         emit dataChanged();
@@ -379,4 +539,132 @@ int DataManager::getNextWorkoutId() const
         maxId = qMax(maxId, id);
     }
     return maxId + 1;
-} 
\ No newline at end of file
+} 
+
+QList<int> DataManager::getTrainedExerciseIds() const
+{
+    return m_strengthIndex.exerciseIds();
+}
+
+QString DataManager::getTrainedExerciseName(int exerciseId) const
+{
+    // Prefer the library name; fall back to the name recorded in the workout
+    auto exercise = m_exercises.constFind(exerciseId);
+    if (exercise != m_exercises.constEnd() && !exercise.value().name().isEmpty()) {
+        return exercise.value().name();
+    }
+    return m_strengthIndex.exerciseName(exerciseId);
+}
+
+QList<StrengthIndex::DayPoint> DataManager::getStrengthSeries(int exerciseId,
+                                                              const QDate &start,
+                                                              const QDate &end) const
+{
+    return m_strengthIndex.series(exerciseId, start, end);
+}
+
+QList<StrengthIndex::Session> DataManager::getStrengthSessions(int exerciseId) const
+{
+    return m_strengthIndex.sessions(exerciseId);
+}
+
+PersonalRecordIndex::Records DataManager::getPersonalRecords(int exerciseId) const
+{
+    return m_personalRecords.records(exerciseId);
+}
+
+QList<PersonalRecordIndex::Achievement> DataManager::getPersonalRecordsSetBy(const Workout &workout) const
+{
+    return m_personalRecords.achievements(workout);
+}
+
+QList<VolumeRollup::Bucket> DataManager::getVolumeRollup(VolumeRollup::Period period,
+                                                        const QDate &start,
+                                                        const QDate &end) const
+{
+    return m_volumeRollup.buckets(period, start, end);
+}
+
+QStringList DataManager::getVolumeCategories() const
+{
+    return m_volumeRollup.categories();
+}
+
+QList<TrainingLoad::Day> DataManager::getTrainingLoad(const QDate &start, const QDate &end) const
+{
+    return m_trainingLoad.days(start, end);
+}
+
+TrainingLoad::Parameters DataManager::getTrainingLoadParameters() const
+{
+    return m_trainingLoad.parameters();
+}
+
+void DataManager::refitTrainingLoad()
+{
+    m_trainingLoad.refit();
+}
+
+QList<NotesIndex::Match> DataManager::searchNotes(const QString &query, int limit) const
+{
+    return m_notesIndex.search(query, limit);
+}
+
+DataManager::Stats DataManager::getStats() const
+{
+    Stats stats;
+    stats.bodyCompositionEntries = m_bodyCompositionData.size();
+    stats.workouts = m_workouts.size();
+    stats.exercises = m_exercises.size();
+    stats.notes = m_notesIndex.documentCount();
+    stats.dataFilePath = m_dataFilePath;
+    stats.dataFileBytes = QFileInfo(m_dataFilePath).size();
+    return stats;
+}
+
+void DataManager::rebuildWorkoutIndexes()
+{
+    QHash<int, QString> categories;
+    for (auto it = m_exercises.constBegin(); it != m_exercises.constEnd(); ++it) {
+        categories[it.key()] = it.value().category();
+    }
+    m_volumeRollup.setCategories(categories);
+    
+    m_workoutsByDate.clear();
+    m_activity.clear(ActivityBitmap::Workout);
+    m_notesIndex.clearWorkouts();
+    for (auto it = m_workouts.constBegin(); it != m_workouts.constEnd(); ++it) {
+        m_workoutsByDate.insert(it.value().date(), it.key());
+        m_activity.set(ActivityBitmap::Workout, it.value().date(), true);
+        m_notesIndex.addWorkout(it.value());
+    }
+    
+    m_strengthIndex.rebuild(m_workouts);
+    m_personalRecords.rebuild();
+    m_volumeRollup.rebuild(m_workouts);
+    m_trainingLoad.rebuild(m_workouts);
+}
+
+void DataManager::indexWorkout(const Workout &workout)
+{
+    m_workoutsByDate.insert(workout.date(), workout.id());
+    m_activity.set(ActivityBitmap::Workout, workout.date(), true);
+    m_notesIndex.addWorkout(workout);
+    m_strengthIndex.addWorkout(workout);
+    m_personalRecords.addWorkout(workout);
+    m_volumeRollup.addWorkout(workout);
+    m_trainingLoad.addWorkout(workout);
+}
+
+void DataManager::unindexWorkout(const Workout &workout)
+{
+    m_workoutsByDate.remove(workout.date(), workout.id());
+    if (!m_workoutsByDate.contains(workout.date())) {
+        m_activity.set(ActivityBitmap::Workout, workout.date(), false);
+    }
+    m_notesIndex.removeWorkout(workout.id());
+    m_personalRecords.removeWorkout(workout);
+    m_strengthIndex.removeWorkout(workout);
+    m_volumeRollup.removeWorkout(workout);
+    m_trainingLoad.removeWorkout(workout);
+}
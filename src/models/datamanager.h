@@ -4,10 +4,22 @@
 #include <QObject>
 #include <QDate>
 #include <QMap>
+#include <QMultiMap>
 #include <QList>
 #include "bodycomposition.h"
 #include "exercise.h"
+#include "exercisemodel.h"
+#include "exercisesearchindex.h"
 #include "workout.h"
+#include "bodycompositionindex.h"
+#include "trendfilter.h"
+#include "goalprojection.h"
+#include "strengthindex.h"
+#include "personalrecordindex.h"
+#include "volumerollup.h"
+#include "trainingload.h"
+#include "activitybitmap.h"
+#include "notesindex.h"
 
 class DataManager : public QObject
 {
@@ -15,6 +27,9 @@ class DataManager : public QObject
 
 public:
     explicit DataManager(QObject *parent = nullptr);
+    // Reads and writes the given file instead of the per-user data file
+    // (tools, benchmarks)
+    explicit DataManager(const QString &dataFilePath, QObject *parent = nullptr);
     
     // Body composition data management
     bool saveBodyComposition(const BodyComposition &data);
@@ -28,6 +43,17 @@ public:
     QList<BodyComposition> getAllBodyCompositionSorted() const;
     QPair<double, double> getWeightRange() const;
     QPair<QDate, QDate> getDataDateRange() const;
+    BodyCompositionIndex::RangeStats getBodyCompositionStats(BodyCompositionIndex::Metric metric,
+                                                             const QDate &start = QDate(),
+                                                             const QDate &end = QDate()) const;
+    QList<TrendFilter::Point> getTrendPoints(BodyCompositionIndex::Metric metric,
+                                             const QDate &start = QDate(),
+                                             const QDate &end = QDate()) const;
+    GoalProjection::Result projectGoal(BodyCompositionIndex::Metric metric, double goal) const;
+    
+    // Bulk recomputation of derived metrics (BMI, body fat) for the whole history
+    bool recomputeDerivedMetrics();
+    bool applyProfileCorrection(double height, bool isMale);
     
     // Exercise library management
     bool saveExercise(const Exercise &exercise);
@@ -36,15 +62,57 @@ public:
     QList<Exercise> getExercisesByCategory(const QString &category) const;
     bool deleteExercise(int id);
     int getNextExerciseId() const;
+    ExerciseModel *getExerciseModel() { return &m_exerciseModel; }
+    QList<ExerciseSearchIndex::Match> searchExercises(const QString &query, int limit = 20,
+                                                      bool activeOnly = false) const;
     
     // Workout management
-    bool saveWorkout(const Workout &workout);
+    // New workouts (id 0) get the next free id, reported through savedId
+    bool saveWorkout(const Workout &workout, int *savedId = nullptr);
     Workout loadWorkout(int id);
     QList<Workout> getAllWorkouts() const;
     QList<Workout> getWorkoutsByDate(const QDate &date) const;
     bool deleteWorkout(int id);
     int getNextWorkoutId() const;
     
+    // Strength analytics (per-exercise session history)
+    QList<int> getTrainedExerciseIds() const;
+    QString getTrainedExerciseName(int exerciseId) const;
+    QList<StrengthIndex::DayPoint> getStrengthSeries(int exerciseId,
+                                                     const QDate &start = QDate(),
+                                                     const QDate &end = QDate()) const;
+    QList<StrengthIndex::Session> getStrengthSessions(int exerciseId) const;
+    PersonalRecordIndex::Records getPersonalRecords(int exerciseId) const;
+    QList<PersonalRecordIndex::Achievement> getPersonalRecordsSetBy(const Workout &workout) const;
+    
+    // Training volume per period and exercise category
+    QList<VolumeRollup::Bucket> getVolumeRollup(VolumeRollup::Period period,
+                                                const QDate &start = QDate(),
+                                                const QDate &end = QDate()) const;
+    QStringList getVolumeCategories() const;
+    
+    // Training load (acute:chronic ratio, fitness-fatigue model)
+    QList<TrainingLoad::Day> getTrainingLoad(const QDate &start = QDate(), const QDate &end = QDate()) const;
+    TrainingLoad::Parameters getTrainingLoadParameters() const;
+    void refitTrainingLoad();
+    
+    // Logged days (body composition, workouts) for streaks and the calendar heatmap
+    const ActivityBitmap &getActivity() const { return m_activity; }
+    
+    // Full-text search over body composition, workout and exercise notes
+    QList<NotesIndex::Match> searchNotes(const QString &query, int limit = 200) const;
+    
+    // Entity counts and file size for the diagnostics window
+    struct Stats {
+        int bodyCompositionEntries = 0;
+        int workouts = 0;
+        int exercises = 0;
+        int notes = 0;
+        qint64 dataFileBytes = 0;
+        QString dataFilePath;
+    };
+    Stats getStats() const;
+    
     // Data persistence
     bool loadData();
     bool saveData();
@@ -55,10 +123,26 @@ signals:
 private:
     QString getDataFilePath() const;
     void ensureDataDirectory() const;
+    void rebuildBodyCompositionIndexes();
+    void rebuildWorkoutIndexes();
+    void indexWorkout(const Workout &workout);
+    void unindexWorkout(const Workout &workout);
     
     QMap<QDate, BodyComposition> m_bodyCompositionData;
+    BodyCompositionIndex m_bodyCompositionIndex;
+    TrendFilter m_weightTrend;
+    TrendFilter m_bodyFatTrend;
     QMap<int, Exercise> m_exercises;
+    ExerciseModel m_exerciseModel;
+    ExerciseSearchIndex m_exerciseSearch;
     QMap<int, Workout> m_workouts;
+    QMultiMap<QDate, int> m_workoutsByDate;
+    StrengthIndex m_strengthIndex;
+    PersonalRecordIndex m_personalRecords;
+    VolumeRollup m_volumeRollup;
+    TrainingLoad m_trainingLoad;
+    ActivityBitmap m_activity;
+    NotesIndex m_notesIndex;
     QString m_dataFilePath;
 };
 
@@ -0,0 +1,148 @@
+#include "exercisemodel.h"
+
+ExerciseModel::ExerciseModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void ExerciseModel::reset(const QMap<int, Exercise> &exercises)
+{
+    beginResetModel();
+    m_rows = exercises.values();
+    m_rowById.clear();
+    m_rowById.reserve(m_rows.size());
+    for (int row = 0; row < m_rows.size(); ++row) {
+        m_rowById.insert(m_rows.at(row).id(), row);
+    }
+    endResetModel();
+}
+
+void ExerciseModel::upsert(const Exercise &exercise)
+{
+    auto existing = m_rowById.constFind(exercise.id());
+    if (existing != m_rowById.constEnd()) {
+        int row = existing.value();
+        m_rows[row] = exercise;
+        emit dataChanged(index(row, 0), index(row, ColumnCount - 1));
+        return;
+    }
+
+    int row = m_rows.size();
+    beginInsertRows(QModelIndex(), row, row);
+    m_rows.append(exercise);
+    m_rowById.insert(exercise.id(), row);
+    endInsertRows();
+}
+
+void ExerciseModel::remove(int exerciseId)
+{
+    int row = m_rowById.value(exerciseId, -1);
+    if (row < 0) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_rows.removeAt(row);
+    m_rowById.remove(exerciseId);
+    for (int i = row; i < m_rows.size(); ++i) {
+        m_rowById[m_rows.at(i).id()] = i;
+    }
+    endRemoveRows();
+}
+
+int ExerciseModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int ExerciseModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant ExerciseModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const Exercise &exercise = m_rows.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+        switch (index.column()) {
+        case IdColumn:
+            return exercise.id();
+        case NameColumn:
+            return exercise.name();
+        case CategoryColumn:
+            return exercise.category();
+        case StatusColumn:
+            return exercise.isActive() ? QString("Active") : QString("Inactive");
+        }
+        break;
+    case IdRole:
+        return exercise.id();
+    case ActiveRole:
+        return exercise.isActive();
+    }
+    return QVariant();
+}
+
+QVariant ExerciseModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section) {
+    case IdColumn:
+        return QString("ID");
+    case NameColumn:
+        return QString("Name");
+    case CategoryColumn:
+        return QString("Category");
+    case StatusColumn:
+        return QString("Status");
+    }
+    return QVariant();
+}
+
+ExerciseFilterModel::ExerciseFilterModel(QObject *parent)
+    : QSortFilterProxyModel(parent)
+    , m_activeOnly(false)
+    , m_hasMatches(false)
+{
+    setSortCaseSensitivity(Qt::CaseInsensitive);
+}
+
+void ExerciseFilterModel::setActiveOnly(bool activeOnly)
+{
+    m_activeOnly = activeOnly;
+    invalidateFilter();
+}
+
+void ExerciseFilterModel::setMatches(const QSet<int> &exerciseIds)
+{
+    m_matches = exerciseIds;
+    m_hasMatches = true;
+    invalidateFilter();
+}
+
+void ExerciseFilterModel::clearMatches()
+{
+    if (!m_hasMatches) {
+        return;
+    }
+    m_matches.clear();
+    m_hasMatches = false;
+    invalidateFilter();
+}
+
+bool ExerciseFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+    if (m_activeOnly && !index.data(ExerciseModel::ActiveRole).toBool()) {
+        return false;
+    }
+    return !m_hasMatches || m_matches.contains(index.data(ExerciseModel::IdRole).toInt());
+}
@@ -0,0 +1,76 @@
+#ifndef EXERCISEMODEL_H
+#define EXERCISEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QSortFilterProxyModel>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include "exercise.h"
+
+// The exercise library as a table model, owned by DataManager and shared by
+// the library table and every exercise combo box. Saves and deletes are
+// applied as single-row insert/change/remove signals instead of a reset, so
+// views keep their selection and only touch the affected row. Rows are in
+// insertion order; views sort through a QSortFilterProxyModel.
+class ExerciseModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        IdColumn,
+        NameColumn,
+        CategoryColumn,
+        StatusColumn,
+        ColumnCount
+    };
+
+    enum Roles {
+        IdRole = Qt::UserRole,  // QComboBox::currentData() reads this
+        ActiveRole
+    };
+
+    explicit ExerciseModel(QObject *parent = nullptr);
+
+    // Maintenance
+    void reset(const QMap<int, Exercise> &exercises);
+    void upsert(const Exercise &exercise);
+    void remove(int exerciseId);
+
+    int rowOf(int exerciseId) const { return m_rowById.value(exerciseId, -1); }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    QList<Exercise> m_rows;
+    QHash<int, int> m_rowById;
+};
+
+// Proxy over ExerciseModel that can hide inactive exercises and restrict the
+// rows to a set of search matches
+class ExerciseFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    explicit ExerciseFilterModel(QObject *parent = nullptr);
+
+    void setActiveOnly(bool activeOnly);
+    void setMatches(const QSet<int> &exerciseIds);
+    void clearMatches();
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+private:
+    bool m_activeOnly;
+    bool m_hasMatches;
+    QSet<int> m_matches;
+};
+
+#endif // EXERCISEMODEL_H
@@ -0,0 +1,252 @@
+#include "exercisesearchindex.h"
+#include "utils/postings.h"
+#include <algorithm>
+
+namespace {
+// Word starts are padded with spaces; the start of a name is also indexed
+// with a pad that normalized text can never contain
+const QChar kWordPad(' ');
+const QChar kAnchorPad(0x01);
+
+// Each query trigram adds one hit, each anchor adds kAnchorHit, so a single
+// counter carries both. Queries are capped well below 256 trigrams.
+constexpr int kAnchorHit = 256;
+constexpr qsizetype kMaxQueryLength = 64;
+
+quint64 packTrigram(QChar a, QChar b, QChar c)
+{
+    return (quint64(a.unicode()) << 32) | (quint64(b.unicode()) << 16) | quint64(c.unicode());
+}
+
+// Edits tolerated for a query of this length. One edit breaks at most
+// three trigrams.
+int allowedTypos(qsizetype queryLength)
+{
+    if (queryLength <= 3) {
+        return 0;
+    }
+    return queryLength <= 7 ? 1 : 2;
+}
+}
+
+void ExerciseSearchIndex::rebuild(const QMap<int, Exercise> &exercises)
+{
+    clear();
+    m_slots.reserve(exercises.size());
+    m_slotKeys.reserve(exercises.size());
+    for (auto it = exercises.constBegin(); it != exercises.constEnd(); ++it) {
+        addExercise(it.value());
+    }
+}
+
+void ExerciseSearchIndex::addExercise(const Exercise &exercise)
+{
+    removeExercise(exercise.id());
+
+    const QString name = normalize(exercise.name());
+    QList<quint64> keys = trigramsOf(normalize(QString("%1 %2").arg(exercise.name(), exercise.category())), false);
+
+    Slot info;
+    info.exerciseId = exercise.id();
+    info.trigramCount = quint16(qMin<qsizetype>(keys.size(), 0xffff));
+    info.nameLength = quint16(qMin<qsizetype>(name.size(), 0xffff));
+    info.active = exercise.isActive();
+    keys.append(anchorsOf(name));
+
+    int slot;
+    if (!m_freeSlots.isEmpty()) {
+        slot = m_freeSlots.takeLast();
+        m_slots[slot] = info;
+        m_slotKeys[slot] = keys;
+    } else {
+        slot = m_slots.size();
+        m_slots.append(info);
+        m_slotKeys.append(keys);
+    }
+    m_slotById.insert(info.exerciseId, slot);
+
+    for (quint64 key : keys) {
+        m_postings[key].append(slot);
+    }
+}
+
+void ExerciseSearchIndex::removeExercise(int exerciseId)
+{
+    auto existing = m_slotById.find(exerciseId);
+    if (existing == m_slotById.end()) {
+        return;
+    }
+
+    int slot = existing.value();
+    m_slotById.erase(existing);
+
+    Postings::removeSlot(m_postings, m_slotKeys.at(slot), slot);
+    m_slots[slot] = Slot();
+    m_slotKeys[slot].clear();
+    m_freeSlots.append(slot);
+}
+
+void ExerciseSearchIndex::clear()
+{
+    m_slots.clear();
+    m_slotKeys.clear();
+    m_freeSlots.clear();
+    m_slotById.clear();
+    m_postings.clear();
+    m_hits.clear();
+    m_touched.clear();
+    m_candidates.clear();
+}
+
+QList<ExerciseSearchIndex::Match> ExerciseSearchIndex::search(const QString &query, int limit, bool activeOnly) const
+{
+    QList<Match> matches;
+    const QString normalized = normalize(query).left(kMaxQueryLength);
+    if (normalized.isEmpty()) {
+        return matches;
+    }
+
+    const QList<quint64> queryTrigrams = trigramsOf(normalized, true);
+    const QList<quint64> queryAnchors = anchorsOf(normalized);
+    const int queryCount = queryTrigrams.size();
+    if (m_hits.size() < m_slots.size()) {
+        m_hits.resize(m_slots.size(), 0);
+    }
+
+    // Count shared trigrams per slot, remembering which counters were touched
+    quint16 *hits = m_hits.data();
+    QList<int> &touched = m_touched;
+    touched.clear();
+    auto count = [&](quint64 key, int weight) {
+        auto posting = m_postings.constFind(key);
+        if (posting == m_postings.constEnd()) {
+            return;
+        }
+        for (int slot : posting.value()) {
+            if (hits[slot] == 0) {
+                touched.append(slot);
+            }
+            hits[slot] += weight;
+        }
+    };
+    for (quint64 trigram : queryTrigrams) {
+        count(trigram, 1);
+    }
+    for (quint64 anchor : queryAnchors) {
+        count(anchor, kAnchorHit);
+    }
+
+    QList<Candidate> &candidates = m_candidates;
+    candidates.clear();
+    const int required = qMax((queryCount + 1) / 2, queryCount - 3 * allowedTypos(normalized.length()));
+    const int anchorCount = queryAnchors.size();
+
+    for (int slot : touched) {
+        const int shared = hits[slot] % kAnchorHit;
+        const int anchors = hits[slot] / kAnchorHit;
+        hits[slot] = 0;
+
+        const Slot &info = m_slots.at(slot);
+        if (shared < required || (activeOnly && !info.active)) {
+            continue;
+        }
+
+        // Trigram similarity (Jaccard) favours close, short names. Holding
+        // every query trigram, word-start ones included, means the query is a
+        // prefix of some word; matching the anchors too puts it at the name start.
+        double score = double(shared) / (queryCount + info.trigramCount - shared);
+        if (shared == queryCount) {
+            score += anchors == anchorCount ? 1.0 : 0.5;
+        }
+        candidates.append({score, info.nameLength, info.exerciseId});
+    }
+
+    // Ties go to the shorter name, then the lower id
+    auto better = [](const Candidate &a, const Candidate &b) {
+        if (a.score != b.score) {
+            return a.score > b.score;
+        }
+        if (a.nameLength != b.nameLength) {
+            return a.nameLength < b.nameLength;
+        }
+        return a.exerciseId < b.exerciseId;
+    };
+
+    qsizetype resultCount = candidates.size();
+    if (limit > 0 && limit < resultCount) {
+        std::partial_sort(candidates.begin(), candidates.begin() + limit, candidates.end(), better);
+        resultCount = limit;
+    } else {
+        std::sort(candidates.begin(), candidates.end(), better);
+    }
+
+    matches.reserve(resultCount);
+    for (qsizetype i = 0; i < resultCount; ++i) {
+        matches.append({candidates.at(i).exerciseId, candidates.at(i).score});
+    }
+    return matches;
+}
+
+QString ExerciseSearchIndex::normalize(const QString &text)
+{
+    QString result;
+    result.reserve(text.size());
+    bool pendingSpace = false;
+    for (QChar ch : text) {
+        if (ch.isLetterOrNumber()) {
+            if (pendingSpace && !result.isEmpty()) {
+                result.append(kWordPad);
+            }
+            pendingSpace = false;
+            result.append(ch.toLower());
+        } else {
+            pendingSpace = true;
+        }
+    }
+    return result;
+}
+
+QList<quint64> ExerciseSearchIndex::trigramsOf(const QString &normalized, bool prefixLastWord)
+{
+    QList<quint64> trigrams;
+    qsizetype start = 0;
+
+    while (start < normalized.size()) {
+        qsizetype end = normalized.indexOf(kWordPad, start);
+        if (end < 0) {
+            end = normalized.size();
+        }
+
+        // "  bench " -> "  b", " be", "ben", "enc", "nch", "ch ". The closing
+        // pad is left off a word still being typed.
+        bool closed = !(prefixLastWord && end == normalized.size());
+        qsizetype length = end - start;
+        auto at = [&](qsizetype i) {
+            return i < 2 || i >= length + 2 ? kWordPad : normalized.at(start + i - 2);
+        };
+        qsizetype paddedLength = length + (closed ? 3 : 2);
+        for (qsizetype i = 0; i + 2 < paddedLength; ++i) {
+            trigrams.append(packTrigram(at(i), at(i + 1), at(i + 2)));
+        }
+        start = end + 1;
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+QList<quint64> ExerciseSearchIndex::anchorsOf(const QString &normalized)
+{
+    // The two leading trigrams of the first word, padded with the anchor
+    QList<quint64> anchors;
+    if (normalized.isEmpty()) {
+        return anchors;
+    }
+
+    anchors.append(packTrigram(kAnchorPad, kAnchorPad, normalized.at(0)));
+    if (normalized.size() > 1 && normalized.at(1) != kWordPad) {
+        anchors.append(packTrigram(kAnchorPad, normalized.at(0), normalized.at(1)));
+    }
+    return anchors;
+}
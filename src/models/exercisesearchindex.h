@@ -0,0 +1,69 @@
+#ifndef EXERCISESEARCHINDEX_H
+#define EXERCISESEARCHINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include "exercise.h"
+
+// Typo-tolerant search over exercise names and categories. Every word is
+// indexed by its character trigrams, padded so that word starts have trigrams
+// of their own, and the first word of a name also gets "anchor" trigrams
+// marking the start of the name. A query only visits the posting lists of its
+// own trigrams; candidates are ranked by trigram overlap with a bonus when the
+// query reads as a prefix of the name or of one of its words. The last query
+// word is matched as a prefix, so results follow the user's typing.
+class ExerciseSearchIndex
+{
+public:
+    struct Match {
+        int exerciseId = 0;
+        double score = 0.0;
+    };
+
+    // Maintenance
+    void rebuild(const QMap<int, Exercise> &exercises);
+    void addExercise(const Exercise &exercise);   // replaces an existing entry
+    void removeExercise(int exerciseId);
+    void clear();
+
+    // Best matches first. A limit of 0 returns every match.
+    QList<Match> search(const QString &query, int limit = 20, bool activeOnly = false) const;
+    int size() const { return m_slotById.size(); }
+
+    // Lower case, letters and digits only, words separated by single spaces
+    static QString normalize(const QString &text);
+
+private:
+    // Hot per-slot data, kept compact for the scoring loop
+    struct Slot {
+        int exerciseId = 0;
+        quint16 trigramCount = 0;   // excluding anchors
+        quint16 nameLength = 0;
+        bool active = false;
+    };
+
+    struct Candidate {
+        double score;
+        int nameLength;
+        int exerciseId;
+    };
+
+    static QList<quint64> trigramsOf(const QString &normalized, bool prefixLastWord);
+    static QList<quint64> anchorsOf(const QString &normalized);
+
+    QList<Slot> m_slots;
+    QList<QList<quint64>> m_slotKeys;   // every posting key of a slot, for removal
+    QList<int> m_freeSlots;
+    QHash<int, int> m_slotById;
+    QHash<quint64, QList<int>> m_postings;  // trigram -> slots
+
+    // Query scratch space, reused so a keystroke doesn't allocate. The hit
+    // counters are per slot and always zero between calls.
+    mutable QList<quint16> m_hits;
+    mutable QList<int> m_touched;
+    mutable QList<Candidate> m_candidates;
+};
+
+#endif // EXERCISESEARCHINDEX_H
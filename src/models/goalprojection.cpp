@@ -0,0 +1,225 @@
+#include "goalprojection.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace {
+constexpr double kInv2Pow32 = 1.0 / 4294967296.0;
+
+// Sum of four uniforms has variance 1/3; scaled to unit variance
+constexpr double kIrwinHallScale = 1.7320508075688772;
+
+inline quint64 rotl(quint64 x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+inline quint64 splitmix64(quint64 &state)
+{
+    quint64 z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// xoshiro256++ for GoalProjection::Lanes independent streams, stored as
+// structure-of-arrays so each step is a handful of lane-wise integer ops
+struct LaneRng {
+    quint64 s0[GoalProjection::Lanes];
+    quint64 s1[GoalProjection::Lanes];
+    quint64 s2[GoalProjection::Lanes];
+    quint64 s3[GoalProjection::Lanes];
+
+    LaneRng(quint64 seed, quint64 block)
+    {
+        quint64 state = seed ^ (block * 0xD1B54A32D192ED03ULL);
+        for (int l = 0; l < GoalProjection::Lanes; ++l) {
+            s0[l] = splitmix64(state);
+            s1[l] = splitmix64(state);
+            s2[l] = splitmix64(state);
+            s3[l] = splitmix64(state);
+        }
+    }
+
+    // Approximately standard normal deviates: Irwin-Hall sum of the four
+    // 32-bit halves of two draws. Integer-only, so it vectorizes where
+    // Box-Muller's log/cos calls would not; summed over days the walk is
+    // Gaussian either way.
+    void normal(double *out)
+    {
+        quint64 a[GoalProjection::Lanes];
+        quint64 b[GoalProjection::Lanes];
+        next(a);
+        next(b);
+        for (int l = 0; l < GoalProjection::Lanes; ++l) {
+            double sum = static_cast<double>(a[l] >> 32) + static_cast<double>(a[l] & 0xFFFFFFFFULL)
+                       + static_cast<double>(b[l] >> 32) + static_cast<double>(b[l] & 0xFFFFFFFFULL);
+            out[l] = (sum * kInv2Pow32 - 2.0) * kIrwinHallScale;
+        }
+    }
+
+    void next(quint64 *out)
+    {
+        for (int l = 0; l < GoalProjection::Lanes; ++l) {
+            quint64 result = rotl(s0[l] + s3[l], 23) + s0[l];
+            quint64 t = s1[l] << 17;
+            s2[l] ^= s0[l];
+            s3[l] ^= s1[l];
+            s1[l] ^= s2[l];
+            s0[l] ^= s3[l];
+            s2[l] ^= t;
+            s3[l] = rotl(s3[l], 45);
+            out[l] = result;
+        }
+    }
+};
+
+inline float percentile(float *values, qsizetype count, double fraction)
+{
+    qsizetype k = qBound<qsizetype>(0, static_cast<qsizetype>(fraction * (count - 1) + 0.5), count - 1);
+    std::nth_element(values, values + k, values + count);
+    return values[k];
+}
+}
+
+GoalProjection::Model GoalProjection::fit(const QList<QPair<QDate, double>> &history)
+{
+    // Random walk with drift observed at irregular times: a change Δ over g
+    // days has mean μg and variance σ²g, which gives these estimates
+    Model model;
+    double totalChange = 0.0;
+    qint64 totalDays = 0;
+    for (int i = 1; i < history.size(); ++i) {
+        qint64 gap = history[i - 1].first.daysTo(history[i].first);
+        if (gap <= 0) {
+            continue;
+        }
+        totalChange += history[i].second - history[i - 1].second;
+        totalDays += gap;
+        ++model.changes;
+    }
+    if (model.changes < 2) {
+        return model;
+    }
+    model.drift = totalChange / totalDays;
+
+    double sumSquares = 0.0;
+    for (int i = 1; i < history.size(); ++i) {
+        qint64 gap = history[i - 1].first.daysTo(history[i].first);
+        if (gap <= 0) {
+            continue;
+        }
+        double residual = (history[i].second - history[i - 1].second) - model.drift * gap;
+        sumSquares += residual * residual / gap;
+    }
+    model.volatility = std::sqrt(sumSquares / (model.changes - 1));
+    return model;
+}
+
+GoalProjection::Result GoalProjection::project(const Model &model, const QDate &startDate, double startValue,
+                                               double goal)
+{
+    return project(model, startDate, startValue, goal, Options());
+}
+
+GoalProjection::Result GoalProjection::project(const Model &model, const QDate &startDate, double startValue,
+                                               double goal, const Options &options)
+{
+    Result result;
+    result.model = model;
+    result.startDate = startDate;
+    result.startValue = startValue;
+    result.goal = goal;
+    if (!model.isValid() || !startDate.isValid() || options.horizonDays <= 0) {
+        return result;
+    }
+
+    const int horizon = options.horizonDays;
+    const int bandPoints = qBound(2, options.bandPoints, horizon + 1);
+    const qsizetype blocks = (qMax(1, options.trajectories) + Lanes - 1) / Lanes;
+    const qsizetype trajectories = blocks * Lanes;
+
+    // Day of each band sample, spread evenly over [0, horizon]
+    QList<int> sampleDays(bandPoints);
+    for (int i = 0; i < bandPoints; ++i) {
+        sampleDays[i] = static_cast<int>(static_cast<qint64>(horizon) * i / (bandPoints - 1));
+    }
+
+    // samples[band * trajectories + trajectory]; floats halve the footprint
+    QList<float> samples(bandPoints * trajectories);
+    QList<int> hitDays(trajectories);
+
+    float *sampleData = samples.data();
+    int *hitData = hitDays.data();
+    const int *sampleDayData = sampleDays.constData();
+    const double drift = model.drift;
+    const double volatility = model.volatility;
+    const double direction = goal >= startValue ? 1.0 : -1.0;
+    const quint64 seed = options.seed;
+
+    Parallel::forChunks(blocks, [=](qsizetype beginBlock, qsizetype endBlock) {
+        double value[Lanes];
+        double z[Lanes];
+        int hit[Lanes];
+
+        for (qsizetype block = beginBlock; block < endBlock; ++block) {
+            LaneRng rng(seed, static_cast<quint64>(block));
+            const qsizetype first = block * Lanes;
+            for (int l = 0; l < Lanes; ++l) {
+                value[l] = startValue;
+                hit[l] = direction * (startValue - goal) >= 0.0 ? 0 : INT_MAX;
+                sampleData[first + l] = static_cast<float>(startValue);
+            }
+
+            int nextSample = 1;
+            for (int day = 1; day <= horizon; ++day) {
+                rng.normal(z);
+                for (int l = 0; l < Lanes; ++l) {
+                    value[l] += drift + volatility * z[l];
+                    bool reached = direction * (value[l] - goal) >= 0.0;
+                    hit[l] = (reached & (hit[l] == INT_MAX)) ? day : hit[l];
+                }
+
+                if (nextSample < bandPoints && sampleDayData[nextSample] == day) {
+                    float *row = sampleData + nextSample * trajectories + first;
+                    for (int l = 0; l < Lanes; ++l) {
+                        row[l] = static_cast<float>(value[l]);
+                    }
+                    ++nextSample;
+                }
+            }
+
+            for (int l = 0; l < Lanes; ++l) {
+                hitData[first + l] = hit[l];
+            }
+        }
+    }, 64);
+
+    // Percentile bands, one sample row per task
+    result.bands.resize(bandPoints);
+    BandPoint *bandData = result.bands.data();
+    Parallel::forChunks(bandPoints, [=](qsizetype begin, qsizetype end) {
+        for (qsizetype i = begin; i < end; ++i) {
+            float *row = sampleData + i * trajectories;
+            bandData[i].date = startDate.addDays(sampleDayData[i]);
+            bandData[i].p10 = percentile(row, trajectories, 0.10);
+            bandData[i].p50 = percentile(row, trajectories, 0.50);
+            bandData[i].p90 = percentile(row, trajectories, 0.90);
+        }
+    }, 1);
+
+    // Arrival dates: the day by which a given share of trajectories got there
+    std::sort(hitDays.begin(), hitDays.end());
+    qsizetype reached = std::lower_bound(hitDays.constBegin(), hitDays.constEnd(), INT_MAX) - hitDays.constBegin();
+    result.probability = static_cast<double>(reached) / trajectories;
+
+    auto arrival = [&](double fraction) {
+        qsizetype k = qMin(trajectories - 1, static_cast<qsizetype>(std::ceil(fraction * trajectories)) - 1);
+        return hitDays[k] == INT_MAX ? QDate() : startDate.addDays(hitDays[k]);
+    };
+    result.optimisticDate = arrival(0.10);
+    result.expectedDate = arrival(0.50);
+    result.conservativeDate = arrival(0.90);
+    return result;
+}
@@ -0,0 +1,66 @@
+#ifndef GOALPROJECTION_H
+#define GOALPROJECTION_H
+
+#include <QDate>
+#include <QList>
+#include <QPair>
+
+// Monte Carlo projection of when a body metric reaches a goal. The history
+// is fitted as a random walk with drift (mean and spread of the change per
+// day, allowing for irregular gaps between entries), then tens of thousands
+// of trajectories are simulated from the current value.
+//
+// Trajectories run in blocks of SIMD-width lanes, each lane with its own
+// xoshiro256++ generator, so the inner loops are straight-line array code the
+// compiler can vectorize; blocks are spread across worker threads. Seeds
+// depend only on the block, so a projection is reproducible regardless of
+// thread count.
+class GoalProjection
+{
+public:
+    struct Model {
+        double drift = 0.0;         // mean change per day
+        double volatility = 0.0;    // standard deviation of the change per day
+        int changes = 0;            // intervals the fit is based on
+
+        bool isValid() const { return changes >= 2; }
+    };
+
+    struct Options {
+        int trajectories = 20000;
+        int horizonDays = 365;
+        int bandPoints = 74;        // percentile samples along the horizon, incl. today
+        quint64 seed = 0x5EED5EED5EED5EEDULL;
+    };
+
+    struct BandPoint {
+        QDate date;
+        double p10 = 0.0;
+        double p50 = 0.0;
+        double p90 = 0.0;
+    };
+
+    struct Result {
+        Model model;
+        QDate startDate;
+        double startValue = 0.0;
+        double goal = 0.0;
+        QList<BandPoint> bands;
+        double probability = 0.0;    // share of trajectories reaching the goal within the horizon
+        QDate optimisticDate;        // reached by 10% of trajectories
+        QDate expectedDate;          // reached by 50%
+        QDate conservativeDate;      // reached by 90%
+
+        bool isValid() const { return model.isValid() && !bands.isEmpty(); }
+    };
+
+    static Model fit(const QList<QPair<QDate, double>> &history);
+    static Result project(const Model &model, const QDate &startDate, double startValue, double goal);
+    static Result project(const Model &model, const QDate &startDate, double startValue, double goal,
+                          const Options &options);
+
+    // Lanes per block; matches 512-bit vectors of doubles and keeps AVX2/NEON busy
+    static const int Lanes = 8;
+};
+
+#endif // GOALPROJECTION_H
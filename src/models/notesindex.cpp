@@ -0,0 +1,202 @@
+#include "notesindex.h"
+#include "utils/postings.h"
+#include <algorithm>
+
+void NotesIndex::addBodyComposition(const BodyComposition &data)
+{
+    removeBodyComposition(data.date());
+    if (data.notes().trimmed().isEmpty()) {
+        return;
+    }
+
+    Match match;
+    match.date = data.date();
+    match.source = BodyCompositionNote;
+    match.text = data.notes();
+    m_bodyCompositionSlots.insert(data.date().toJulianDay(), addDocument(match));
+}
+
+void NotesIndex::removeBodyComposition(const QDate &date)
+{
+    auto existing = m_bodyCompositionSlots.find(date.toJulianDay());
+    if (existing != m_bodyCompositionSlots.end()) {
+        removeDocument(existing.value());
+        m_bodyCompositionSlots.erase(existing);
+    }
+}
+
+void NotesIndex::addWorkout(const Workout &workout)
+{
+    removeWorkout(workout.id());
+
+    QList<int> slots;
+    if (!workout.notes().trimmed().isEmpty()) {
+        Match match;
+        match.date = workout.date();
+        match.source = WorkoutNote;
+        match.workoutId = workout.id();
+        match.text = workout.notes();
+        slots.append(addDocument(match));
+    }
+
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        if (exercise.notes().trimmed().isEmpty()) {
+            continue;
+        }
+        Match match;
+        match.date = workout.date();
+        match.source = ExerciseNote;
+        match.workoutId = workout.id();
+        match.context = exercise.exerciseName();
+        match.text = exercise.notes();
+        slots.append(addDocument(match));
+    }
+
+    if (!slots.isEmpty()) {
+        m_workoutSlots.insert(workout.id(), slots);
+    }
+}
+
+void NotesIndex::removeWorkout(int workoutId)
+{
+    auto existing = m_workoutSlots.find(workoutId);
+    if (existing == m_workoutSlots.end()) {
+        return;
+    }
+    for (int slot : existing.value()) {
+        removeDocument(slot);
+    }
+    m_workoutSlots.erase(existing);
+}
+
+void NotesIndex::clearBodyComposition()
+{
+    for (auto it = m_bodyCompositionSlots.constBegin(); it != m_bodyCompositionSlots.constEnd(); ++it) {
+        removeDocument(it.value());
+    }
+    m_bodyCompositionSlots.clear();
+}
+
+void NotesIndex::clearWorkouts()
+{
+    for (auto it = m_workoutSlots.constBegin(); it != m_workoutSlots.constEnd(); ++it) {
+        for (int slot : it.value()) {
+            removeDocument(slot);
+        }
+    }
+    m_workoutSlots.clear();
+}
+
+QList<NotesIndex::Match> NotesIndex::search(const QString &query, int limit) const
+{
+    QList<Match> results;
+    const QStringList words = tokenize(query);
+    if (words.isEmpty()) {
+        return results;
+    }
+
+    if (m_matched.size() < m_documents.size()) {
+        m_matched.resize(m_documents.size(), 0);
+    }
+
+    // A document survives word i only if it matched words 0..i-1; counting
+    // only from i keeps two tokens sharing a prefix from matching twice
+    QList<int> candidates;
+    int *matched = m_matched.data();
+    for (int i = 0; i < words.size(); ++i) {
+        const QString &word = words.at(i);
+        for (auto it = m_postings.lowerBound(word); it != m_postings.constEnd() && it.key().startsWith(word); ++it) {
+            for (int slot : it.value()) {
+                if (matched[slot] == i) {
+                    matched[slot] = i + 1;
+                    if (i == 0) {
+                        candidates.append(slot);
+                    }
+                }
+            }
+        }
+    }
+
+    QList<int> hits;
+    for (int slot : candidates) {
+        if (matched[slot] == words.size()) {
+            hits.append(slot);
+        }
+        matched[slot] = 0;
+    }
+
+    // Newest first, then body composition before workout and exercise notes
+    auto newer = [this](int a, int b) {
+        const Match &left = m_documents.at(a).match;
+        const Match &right = m_documents.at(b).match;
+        if (left.date != right.date) {
+            return left.date > right.date;
+        }
+        if (left.source != right.source) {
+            return left.source < right.source;
+        }
+        return a < b;
+    };
+
+    qsizetype count = hits.size();
+    if (limit > 0 && limit < count) {
+        std::partial_sort(hits.begin(), hits.begin() + limit, hits.end(), newer);
+        count = limit;
+    } else {
+        std::sort(hits.begin(), hits.end(), newer);
+    }
+
+    results.reserve(count);
+    for (qsizetype i = 0; i < count; ++i) {
+        results.append(m_documents.at(hits.at(i)).match);
+    }
+    return results;
+}
+
+QStringList NotesIndex::tokenize(const QString &text)
+{
+    QStringList tokens;
+    QString current;
+    for (QChar ch : text) {
+        if (ch.isLetterOrNumber()) {
+            current.append(ch.toLower());
+        } else if (!current.isEmpty()) {
+            tokens.append(current);
+            current.clear();
+        }
+    }
+    if (!current.isEmpty()) {
+        tokens.append(current);
+    }
+    return tokens;
+}
+
+int NotesIndex::addDocument(const Match &match)
+{
+    Document document;
+    document.match = match;
+    document.tokens = tokenize(match.text);
+    std::sort(document.tokens.begin(), document.tokens.end());
+    document.tokens.erase(std::unique(document.tokens.begin(), document.tokens.end()), document.tokens.end());
+
+    int slot;
+    if (!m_freeSlots.isEmpty()) {
+        slot = m_freeSlots.takeLast();
+        m_documents[slot] = document;
+    } else {
+        slot = m_documents.size();
+        m_documents.append(document);
+    }
+
+    for (const QString &token : m_documents.at(slot).tokens) {
+        m_postings[token].append(slot);
+    }
+    return slot;
+}
+
+void NotesIndex::removeDocument(int slot)
+{
+    Postings::removeSlot(m_postings, m_documents.at(slot).tokens, slot);
+    m_documents[slot] = Document();
+    m_freeSlots.append(slot);
+}
@@ -0,0 +1,71 @@
+#ifndef NOTESINDEX_H
+#define NOTESINDEX_H
+
+#include <QDate>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include "bodycomposition.h"
+#include "workout.h"
+
+// Inverted index over the free-text notes of body composition entries,
+// workouts and workout exercises. Each note is one document; its words map to
+// the documents containing them in a sorted token map, so a query word is
+// answered as a prefix range scan ("shoul" finds "shoulder"). Documents are
+// added and removed per saved entry, so the index stays current without a
+// rebuild.
+class NotesIndex
+{
+public:
+    enum Source {
+        BodyCompositionNote,
+        WorkoutNote,
+        ExerciseNote
+    };
+
+    struct Match {
+        QDate date;
+        Source source = BodyCompositionNote;
+        int workoutId = 0;      // workout and exercise notes
+        QString context;        // exercise name for exercise notes
+        QString text;
+    };
+
+    // Maintenance. Adding replaces what was indexed for the same entry.
+    void addBodyComposition(const BodyComposition &data);
+    void removeBodyComposition(const QDate &date);
+    void addWorkout(const Workout &workout);
+    void removeWorkout(int workoutId);
+    void clearBodyComposition();
+    void clearWorkouts();
+
+    // Notes where every query word is a prefix of one of their words, newest
+    // first. A limit of 0 returns every match.
+    QList<Match> search(const QString &query, int limit = 200) const;
+    int documentCount() const { return m_documents.size() - m_freeSlots.size(); }
+
+    // Lower-cased words; anything but letters and digits separates them
+    static QStringList tokenize(const QString &text);
+
+private:
+    struct Document {
+        Match match;
+        QStringList tokens;     // unique
+    };
+
+    int addDocument(const Match &match);
+    void removeDocument(int slot);
+
+    QList<Document> m_documents;
+    QList<int> m_freeSlots;
+    QHash<qint64, int> m_bodyCompositionSlots;  // julian day -> slot
+    QHash<int, QList<int>> m_workoutSlots;      // workout id -> slots
+    QMap<QString, QList<int>> m_postings;       // token -> slots
+
+    // Query words matched, per slot
+    mutable QList<int> m_matched;
+};
+
+#endif // NOTESINDEX_H
@@ -0,0 +1,188 @@
+#include "personalrecordindex.h"
+
+PersonalRecordIndex::RecordTypes PersonalRecordIndex::Records::heldBy(int workoutId) const
+{
+    RecordTypes types;
+    if (heaviestWeight.workoutId == workoutId) {
+        types |= HeaviestWeight;
+    }
+    if (bestOneRepMax.workoutId == workoutId) {
+        types |= BestOneRepMax;
+    }
+    if (bestVolume.workoutId == workoutId) {
+        types |= BestVolume;
+    }
+    for (const RepRecord &record : bestRepsAtWeight) {
+        if (record.workoutId == workoutId) {
+            types |= MostRepsAtWeight;
+            break;
+        }
+    }
+    return types;
+}
+
+PersonalRecordIndex::PersonalRecordIndex(const StrengthIndex *sessions)
+    : m_sessions(sessions)
+{
+}
+
+void PersonalRecordIndex::rebuild()
+{
+    m_records.clear();
+    const QList<int> exerciseIds = m_sessions->exerciseIds();
+    m_stale = QSet<int>(exerciseIds.constBegin(), exerciseIds.constEnd());
+}
+
+void PersonalRecordIndex::addWorkout(const Workout &workout)
+{
+    if (!workout.date().isValid()) {
+        return;
+    }
+
+    const QHash<int, StrengthIndex::Session> summaries = StrengthIndex::summarize(workout);
+    for (auto it = summaries.constBegin(); it != summaries.constEnd(); ++it) {
+        // Stale exercises pick the new session up when they are recomputed
+        if (m_stale.contains(it.key())) {
+            continue;
+        }
+        addSession(m_records[it.key()], it.value());
+    }
+}
+
+void PersonalRecordIndex::removeWorkout(const Workout &workout)
+{
+    const QHash<int, StrengthIndex::Session> summaries = StrengthIndex::summarize(workout);
+    for (auto it = summaries.constBegin(); it != summaries.constEnd(); ++it) {
+        auto records = m_records.constFind(it.key());
+        if (records != m_records.constEnd() && records.value().heldBy(workout.id())) {
+            m_records.erase(records);
+            m_stale.insert(it.key());
+        }
+    }
+}
+
+void PersonalRecordIndex::clear()
+{
+    m_records.clear();
+    m_stale.clear();
+}
+
+PersonalRecordIndex::Records PersonalRecordIndex::records(int exerciseId) const
+{
+    return ensureFresh(exerciseId);
+}
+
+QList<PersonalRecordIndex::Achievement> PersonalRecordIndex::achievements(const Workout &workout) const
+{
+    QList<Achievement> result;
+
+    const QHash<int, StrengthIndex::Session> summaries = StrengthIndex::summarize(workout);
+    for (auto it = summaries.constBegin(); it != summaries.constEnd(); ++it) {
+        const Records &records = ensureFresh(it.key());
+        RecordTypes held = records.heldBy(workout.id());
+
+        if (held & HeaviestWeight) {
+            result.append({it.key(), HeaviestWeight, records.heaviestWeight.value, 0});
+        }
+        if (held & MostRepsAtWeight) {
+            for (auto rep = records.bestRepsAtWeight.constBegin(); rep != records.bestRepsAtWeight.constEnd(); ++rep) {
+                if (rep.value().workoutId == workout.id()) {
+                    result.append({it.key(), MostRepsAtWeight, rep.key(), rep.value().reps});
+                }
+            }
+        }
+        if (held & BestOneRepMax) {
+            result.append({it.key(), BestOneRepMax, records.bestOneRepMax.value, 0});
+        }
+        if (held & BestVolume) {
+            result.append({it.key(), BestVolume, records.bestVolume.value, 0});
+        }
+    }
+
+    return result;
+}
+
+bool PersonalRecordIndex::improves(const Achievement &achievement, const Records &before)
+{
+    switch (achievement.type) {
+    case HeaviestWeight:
+        return !before.heaviestWeight.isValid() || achievement.value > before.heaviestWeight.value;
+    case MostRepsAtWeight:
+        return achievement.reps > before.bestRepsAtWeight.value(achievement.value).reps;
+    case BestOneRepMax:
+        return !before.bestOneRepMax.isValid() || achievement.value > before.bestOneRepMax.value;
+    case BestVolume:
+        return !before.bestVolume.isValid() || achievement.value > before.bestVolume.value;
+    }
+    return false;
+}
+
+QString PersonalRecordIndex::recordTypeName(RecordType type)
+{
+    switch (type) {
+    case HeaviestWeight:
+        return "Heaviest weight";
+    case MostRepsAtWeight:
+        return "Most reps";
+    case BestOneRepMax:
+        return "Best estimated 1RM";
+    case BestVolume:
+        return "Best session volume";
+    }
+    return QString();
+}
+
+bool PersonalRecordIndex::beats(double value, const QDate &date, int workoutId, const Record &record)
+{
+    // Ties go to whoever got there first, whatever order workouts arrive in
+    if (!record.isValid() || value > record.value) {
+        return true;
+    }
+    return value == record.value && isEarlier(date, workoutId, record.date, record.workoutId);
+}
+
+bool PersonalRecordIndex::beats(int reps, const QDate &date, int workoutId, const RepRecord &record)
+{
+    if (record.workoutId <= 0 || reps > record.reps) {
+        return true;
+    }
+    return reps == record.reps && isEarlier(date, workoutId, record.date, record.workoutId);
+}
+
+bool PersonalRecordIndex::isEarlier(const QDate &date, int workoutId, const QDate &otherDate, int otherWorkoutId)
+{
+    return date < otherDate || (date == otherDate && workoutId < otherWorkoutId);
+}
+
+void PersonalRecordIndex::addSession(Records &records, const StrengthIndex::Session &session)
+{
+    if (beats(session.topWeight, session.date, session.workoutId, records.heaviestWeight)) {
+        records.heaviestWeight = {session.topWeight, session.date, session.workoutId};
+    }
+    if (beats(session.bestEpley, session.date, session.workoutId, records.bestOneRepMax)) {
+        records.bestOneRepMax = {session.bestEpley, session.date, session.workoutId};
+    }
+    if (beats(session.volume, session.date, session.workoutId, records.bestVolume)) {
+        records.bestVolume = {session.volume, session.date, session.workoutId};
+    }
+
+    for (const SetData &set : session.sets) {
+        RepRecord &record = records.bestRepsAtWeight[set.weight()];
+        if (beats(set.reps(), session.date, session.workoutId, record)) {
+            record = {set.reps(), session.date, session.workoutId};
+        }
+    }
+}
+
+const PersonalRecordIndex::Records &PersonalRecordIndex::ensureFresh(int exerciseId) const
+{
+    if (m_stale.contains(exerciseId)) {
+        Records records;
+        for (const StrengthIndex::Session &session : m_sessions->sessions(exerciseId)) {
+            addSession(records, session);
+        }
+        m_records[exerciseId] = records;
+        m_stale.remove(exerciseId);
+    }
+    return m_records[exerciseId];
+}
@@ -0,0 +1,96 @@
+#ifndef PERSONALRECORDINDEX_H
+#define PERSONALRECORDINDEX_H
+
+#include <QDate>
+#include <QFlags>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include "strengthindex.h"
+
+// Personal records per exercise: heaviest weight, most reps at each weight,
+// best estimated one-rep max (Epley) and biggest session volume. Records are
+// updated in place as workouts are added. When a removed workout held one of
+// an exercise's records, only that exercise is marked stale and recomputed
+// from the strength index the next time it is queried.
+class PersonalRecordIndex
+{
+public:
+    enum RecordType {
+        HeaviestWeight = 0x1,
+        MostRepsAtWeight = 0x2,
+        BestOneRepMax = 0x4,
+        BestVolume = 0x8
+    };
+    Q_DECLARE_FLAGS(RecordTypes, RecordType)
+
+    struct Record {
+        double value = 0.0;
+        QDate date;
+        int workoutId = 0;
+
+        bool isValid() const { return workoutId > 0; }
+    };
+
+    struct RepRecord {
+        int reps = 0;
+        QDate date;
+        int workoutId = 0;
+    };
+
+    struct Records {
+        Record heaviestWeight;
+        Record bestOneRepMax;
+        Record bestVolume;
+        QMap<double, RepRecord> bestRepsAtWeight;
+
+        bool isEmpty() const { return !heaviestWeight.isValid(); }
+        RecordTypes heldBy(int workoutId) const;
+    };
+
+    // A record currently held by a given workout
+    struct Achievement {
+        int exerciseId = 0;
+        RecordType type = HeaviestWeight;
+        double value = 0.0;
+        int reps = 0;
+    };
+
+    explicit PersonalRecordIndex(const StrengthIndex *sessions);
+
+    // Maintenance. rebuild() only marks every exercise stale; records are
+    // computed per exercise on first query.
+    void rebuild();
+    void addWorkout(const Workout &workout);
+    void removeWorkout(const Workout &workout);
+    void clear();
+
+    // Queries
+    Records records(int exerciseId) const;
+    QList<Achievement> achievements(const Workout &workout) const;
+
+    // True when the achievement beats the exercise's records as they stood
+    // before the workout was saved
+    static bool improves(const Achievement &achievement, const Records &before);
+
+    static QString recordTypeName(RecordType type);
+
+private:
+    static bool beats(double value, const QDate &date, int workoutId, const Record &record);
+    static bool beats(int reps, const QDate &date, int workoutId, const RepRecord &record);
+    static bool isEarlier(const QDate &date, int workoutId, const QDate &otherDate, int otherWorkoutId);
+    static void addSession(Records &records, const StrengthIndex::Session &session);
+    const Records &ensureFresh(int exerciseId) const;
+
+    const StrengthIndex *m_sessions;
+
+    // Computed lazily, hence mutable
+    mutable QHash<int, Records> m_records;
+    mutable QSet<int> m_stale;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(PersonalRecordIndex::RecordTypes)
+
+#endif // PERSONALRECORDINDEX_H
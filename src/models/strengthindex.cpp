@@ -0,0 +1,159 @@
+#include "strengthindex.h"
+#include <algorithm>
+
+double StrengthIndex::Session::oneRepMax(Calculations::OneRepMaxFormula formula) const
+{
+    return formula == Calculations::Brzycki ? bestBrzycki : bestEpley;
+}
+
+double StrengthIndex::DayPoint::oneRepMax(Calculations::OneRepMaxFormula formula) const
+{
+    return formula == Calculations::Brzycki ? bestBrzycki : bestEpley;
+}
+
+void StrengthIndex::rebuild(const QMap<int, Workout> &workouts)
+{
+    clear();
+    for (auto it = workouts.constBegin(); it != workouts.constEnd(); ++it) {
+        addWorkout(it.value());
+    }
+}
+
+void StrengthIndex::addWorkout(const Workout &workout)
+{
+    if (!workout.date().isValid()) {
+        return;
+    }
+
+    const QHash<int, Session> summaries = summarize(workout);
+    for (auto it = summaries.constBegin(); it != summaries.constEnd(); ++it) {
+        m_sessions[it.key()][workout.date()][workout.id()] = it.value();
+    }
+
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        if (exercise.exerciseId() > 0 && !exercise.exerciseName().isEmpty()) {
+            m_names[exercise.exerciseId()] = exercise.exerciseName();
+        }
+    }
+}
+
+void StrengthIndex::removeWorkout(const Workout &workout)
+{
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        auto byExercise = m_sessions.find(exercise.exerciseId());
+        if (byExercise == m_sessions.end()) {
+            continue;
+        }
+
+        auto byDate = byExercise.value().find(workout.date());
+        if (byDate == byExercise.value().end()) {
+            continue;
+        }
+
+        byDate.value().remove(workout.id());
+        if (byDate.value().isEmpty()) {
+            byExercise.value().erase(byDate);
+        }
+        if (byExercise.value().isEmpty()) {
+            m_sessions.erase(byExercise);
+        }
+    }
+}
+
+void StrengthIndex::clear()
+{
+    m_sessions.clear();
+    m_names.clear();
+}
+
+QList<int> StrengthIndex::exerciseIds() const
+{
+    QList<int> ids = m_sessions.keys();
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+QList<StrengthIndex::DayPoint> StrengthIndex::series(int exerciseId, const QDate &start, const QDate &end) const
+{
+    QList<DayPoint> result;
+    auto byExercise = m_sessions.constFind(exerciseId);
+    if (byExercise == m_sessions.constEnd()) {
+        return result;
+    }
+
+    const QMap<QDate, QMap<int, Session>> &byDate = byExercise.value();
+    auto it = start.isValid() ? byDate.lowerBound(start) : byDate.constBegin();
+    for (; it != byDate.constEnd(); ++it) {
+        if (end.isValid() && it.key() > end) {
+            break;
+        }
+
+        DayPoint point;
+        point.date = it.key();
+        for (const Session &session : it.value()) {
+            point.topWeight = qMax(point.topWeight, session.topWeight);
+            point.bestEpley = qMax(point.bestEpley, session.bestEpley);
+            point.bestBrzycki = qMax(point.bestBrzycki, session.bestBrzycki);
+            point.volume += session.volume;
+        }
+        result.append(point);
+    }
+
+    return result;
+}
+
+QList<StrengthIndex::Session> StrengthIndex::sessions(int exerciseId) const
+{
+    QList<Session> result;
+    auto byExercise = m_sessions.constFind(exerciseId);
+    if (byExercise == m_sessions.constEnd()) {
+        return result;
+    }
+
+    for (const QMap<int, Session> &byWorkout : byExercise.value()) {
+        for (const Session &session : byWorkout) {
+            result.append(session);
+        }
+    }
+    return result;
+}
+
+QHash<int, StrengthIndex::Session> StrengthIndex::summarize(const Workout &workout)
+{
+    QHash<int, Session> summaries;
+
+    // An exercise listed twice in one workout counts as one session
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        if (exercise.exerciseId() <= 0) {
+            continue;
+        }
+
+        Session &session = summaries[exercise.exerciseId()];
+        session.workoutId = workout.id();
+        session.date = workout.date();
+
+        for (const SetData &set : exercise.setsData()) {
+            if (!set.isValid()) {
+                continue;
+            }
+            session.sets.append(set);
+            session.topWeight = qMax(session.topWeight, set.weight());
+            session.bestEpley = qMax(session.bestEpley, Calculations::epleyOneRepMax(set.weight(), set.reps()));
+            session.bestBrzycki = qMax(session.bestBrzycki, Calculations::brzyckiOneRepMax(set.weight(), set.reps()));
+            session.volume += set.weight() * set.reps() * set.sets();
+            session.totalReps += set.reps() * set.sets();
+            session.totalSets += set.sets();
+        }
+    }
+
+    // Exercises logged without any usable set don't produce a data point
+    for (auto it = summaries.begin(); it != summaries.end();) {
+        if (it.value().sets.isEmpty()) {
+            it = summaries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    return summaries;
+}
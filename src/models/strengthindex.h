@@ -0,0 +1,69 @@
+#ifndef STRENGTHINDEX_H
+#define STRENGTHINDEX_H
+
+#include <QDate>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include "workout.h"
+#include "setdata.h"
+#include "utils/calculations.h"
+
+// Per-exercise time series over the workout history. Every workout an
+// exercise appears in becomes one session summary (top weight, estimated
+// one-rep max, volume), stored by exercise and date. The index is built once
+// at load and then patched per saved or deleted workout, so charts read a
+// date window in O(log n + k) instead of rescanning every workout.
+class StrengthIndex
+{
+public:
+    // One exercise's work within a single workout
+    struct Session {
+        int workoutId = 0;
+        QDate date;
+        QList<SetData> sets;
+        double topWeight = 0.0;
+        double bestEpley = 0.0;
+        double bestBrzycki = 0.0;
+        double volume = 0.0;    // weight × reps × sets
+        int totalReps = 0;
+        int totalSets = 0;
+
+        double oneRepMax(Calculations::OneRepMaxFormula formula) const;
+    };
+
+    // All sessions of one exercise on one day combined
+    struct DayPoint {
+        QDate date;
+        double topWeight = 0.0;
+        double bestEpley = 0.0;
+        double bestBrzycki = 0.0;
+        double volume = 0.0;
+
+        double oneRepMax(Calculations::OneRepMaxFormula formula) const;
+    };
+
+    // Maintenance
+    void rebuild(const QMap<int, Workout> &workouts);
+    void addWorkout(const Workout &workout);
+    void removeWorkout(const Workout &workout);
+    void clear();
+
+    // Queries. An invalid start or end date leaves that side of the range open.
+    QList<int> exerciseIds() const;
+    bool hasSessions(int exerciseId) const { return m_sessions.contains(exerciseId); }
+    QString exerciseName(int exerciseId) const { return m_names.value(exerciseId); }
+    QList<DayPoint> series(int exerciseId, const QDate &start = QDate(), const QDate &end = QDate()) const;
+    QList<Session> sessions(int exerciseId) const;
+
+    // Sessions an exercise contributes per workout, keyed by exercise id
+    static QHash<int, Session> summarize(const Workout &workout);
+
+private:
+    // exerciseId -> date -> workoutId -> session
+    QHash<int, QMap<QDate, QMap<int, Session>>> m_sessions;
+    QHash<int, QString> m_names;
+};
+
+#endif // STRENGTHINDEX_H
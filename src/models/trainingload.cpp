@@ -0,0 +1,389 @@
+#include "trainingload.h"
+#include "utils/parallel.h"
+#include <QtMath>
+#include <limits>
+#include <utility>
+
+namespace {
+// Grid for the Banister time constants, in days
+constexpr int kMinFitnessDecay = 10;
+constexpr int kMaxFitnessDecay = 60;
+constexpr int kMinFatigueDecay = 2;
+constexpr int kMaxFatigueDecay = 20;
+
+// Three free parameters; fewer observations than this overfit
+constexpr int kMinObservations = 6;
+
+// Solves the 3×3 system a·x = b in place; false when singular
+bool solve3(double a[3][3], double b[3], double x[3])
+{
+    for (int col = 0; col < 3; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < 3; ++row) {
+            if (qAbs(a[row][col]) > qAbs(a[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (qAbs(a[pivot][col]) < 1e-12) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int k = 0; k < 3; ++k) {
+                std::swap(a[col][k], a[pivot][k]);
+            }
+            std::swap(b[col], b[pivot]);
+        }
+        for (int row = col + 1; row < 3; ++row) {
+            double factor = a[row][col] / a[col][col];
+            for (int k = col; k < 3; ++k) {
+                a[row][k] -= factor * a[col][k];
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+    for (int row = 2; row >= 0; --row) {
+        double sum = b[row];
+        for (int k = row + 1; k < 3; ++k) {
+            sum -= a[row][k] * x[k];
+        }
+        x[row] = sum / a[row][row];
+    }
+    return true;
+}
+
+// Least-squares gains for fixed time constants; rss is +inf when the fit is
+// unusable or not physically meaningful (fitness must help, fatigue hurt)
+TrainingLoad::Parameters fitGains(const double *load, qsizetype dayCount,
+                                  const QPair<int, double> *observations, qsizetype observationCount,
+                                  double fitnessDecay, double fatigueDecay)
+{
+    TrainingLoad::Parameters result;
+    result.fitnessDecay = fitnessDecay;
+    result.fatigueDecay = fatigueDecay;
+    result.rss = std::numeric_limits<double>::infinity();
+    result.observations = static_cast<int>(observationCount);
+
+    const double fitnessRetention = qExp(-1.0 / fitnessDecay);
+    const double fatigueRetention = qExp(-1.0 / fatigueDecay);
+
+    // Normal equations for y = p0 + a·fitness + b·fatigue
+    double ata[3][3] = {};
+    double aty[3] = {};
+    QList<double> fitnessAt(observationCount);
+    QList<double> fatigueAt(observationCount);
+
+    double fitness = 0.0;
+    double fatigue = 0.0;
+    qsizetype next = 0;
+    for (qsizetype day = 0; day < dayCount && next < observationCount; ++day) {
+        fitness = fitness * fitnessRetention + load[day];
+        fatigue = fatigue * fatigueRetention + load[day];
+        while (next < observationCount && observations[next].first == day) {
+            double row[3] = {1.0, fitness, fatigue};
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    ata[i][j] += row[i] * row[j];
+                }
+                aty[i] += row[i] * observations[next].second;
+            }
+            fitnessAt[next] = fitness;
+            fatigueAt[next] = fatigue;
+            ++next;
+        }
+    }
+
+    double x[3];
+    if (!solve3(ata, aty, x) || x[1] <= 0.0 || x[2] >= 0.0) {
+        return result;
+    }
+
+    result.p0 = x[0];
+    result.k1 = x[1];
+    result.k2 = -x[2];
+    result.rss = 0.0;
+    for (qsizetype i = 0; i < observationCount; ++i) {
+        double residual = observations[i].second - (x[0] + x[1] * fitnessAt[i] + x[2] * fatigueAt[i]);
+        result.rss += residual * residual;
+    }
+    result.fitted = true;
+    return result;
+}
+}
+
+TrainingLoad::TrainingLoad(const StrengthIndex *sessions)
+    : m_sessions(sessions)
+    , m_needsFit(true)
+{
+}
+
+void TrainingLoad::rebuild(const QMap<int, Workout> &workouts)
+{
+    clear();
+    for (auto it = workouts.constBegin(); it != workouts.constEnd(); ++it) {
+        addWorkout(it.value());
+    }
+}
+
+void TrainingLoad::addWorkout(const Workout &workout)
+{
+    if (!workout.date().isValid()) {
+        return;
+    }
+
+    DailyLoad &day = m_dailyLoad[workout.date()];
+    day.load += workoutLoad(workout);
+    day.workouts += 1;
+    markDirty(workout.date());
+}
+
+void TrainingLoad::removeWorkout(const Workout &workout)
+{
+    auto it = m_dailyLoad.find(workout.date());
+    if (it == m_dailyLoad.end()) {
+        return;
+    }
+
+    it->workouts -= 1;
+    if (it->workouts <= 0) {
+        m_dailyLoad.erase(it);
+    } else {
+        it->load = qMax(0.0, it->load - workoutLoad(workout));
+    }
+    markDirty(workout.date());
+}
+
+void TrainingLoad::clear()
+{
+    m_dailyLoad.clear();
+    m_timeline.clear();
+    m_dirtyFrom = QDate();
+    m_parameters = Parameters();
+    m_needsFit = true;
+}
+
+void TrainingLoad::refit()
+{
+    m_needsFit = true;
+}
+
+void TrainingLoad::markDirty(const QDate &date)
+{
+    if (!m_dirtyFrom.isValid() || date < m_dirtyFrom) {
+        m_dirtyFrom = date;
+    }
+    m_parameters.stale = m_parameters.fitted;
+}
+
+double TrainingLoad::workoutLoad(const Workout &workout)
+{
+    double volume = 0.0;
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        for (const SetData &set : exercise.setsData()) {
+            if (set.isValid()) {
+                volume += set.weight() * set.reps() * set.sets();
+            }
+        }
+    }
+    return volume / 1000.0;
+}
+
+QList<TrainingLoad::Day> TrainingLoad::days(const QDate &start, const QDate &end) const
+{
+    ensureComputed();
+
+    QList<Day> result;
+    if (m_timeline.isEmpty()) {
+        return result;
+    }
+
+    QDate origin = m_timeline.first().date;
+    qsizetype first = start.isValid() ? qMax<qint64>(0, origin.daysTo(start)) : 0;
+    qsizetype last = end.isValid() ? qMin<qint64>(m_timeline.size() - 1, origin.daysTo(end)) : m_timeline.size() - 1;
+    if (first > last) {
+        return result;
+    }
+    return m_timeline.mid(first, last - first + 1);
+}
+
+TrainingLoad::Parameters TrainingLoad::parameters() const
+{
+    ensureComputed();
+    return m_parameters;
+}
+
+TrainingLoad::Parameters TrainingLoad::fit(const QList<double> &load, const QList<QPair<int, double>> &observations)
+{
+    Parameters best;
+    best.observations = static_cast<int>(observations.size());
+    if (observations.size() < kMinObservations) {
+        return best;
+    }
+
+    QList<QPair<int, int>> grid;
+    for (int fitnessDecay = kMinFitnessDecay; fitnessDecay <= kMaxFitnessDecay; ++fitnessDecay) {
+        for (int fatigueDecay = kMinFatigueDecay; fatigueDecay <= kMaxFatigueDecay && fatigueDecay < fitnessDecay; ++fatigueDecay) {
+            grid.append(qMakePair(fitnessDecay, fatigueDecay));
+        }
+    }
+
+    QList<Parameters> candidates(grid.size());
+
+    const double *loadData = load.constData();
+    const qsizetype dayCount = load.size();
+    const QPair<int, double> *observationData = observations.constData();
+    const qsizetype observationCount = observations.size();
+    const QPair<int, int> *gridData = grid.constData();
+    Parameters *candidateData = candidates.data();
+
+    Parallel::forChunks(grid.size(), [=](qsizetype begin, qsizetype end) {
+        for (qsizetype i = begin; i < end; ++i) {
+            candidateData[i] = fitGains(loadData, dayCount, observationData, observationCount,
+                                        gridData[i].first, gridData[i].second);
+        }
+    }, 32);
+
+    for (const Parameters &candidate : candidates) {
+        if (candidate.fitted && (!best.fitted || candidate.rss < best.rss)) {
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+void TrainingLoad::ensureComputed() const
+{
+    if (m_dailyLoad.isEmpty()) {
+        m_timeline.clear();
+        m_dirtyFrom = QDate();
+        if (m_needsFit) {
+            m_parameters = Parameters();
+            m_needsFit = false;
+        }
+        return;
+    }
+
+    // Dense daily loads from the first workout through today, so rest days decay
+    const QDate origin = m_dailyLoad.firstKey();
+    const QDate last = qMax(m_dailyLoad.lastKey(), QDate::currentDate());
+    const qsizetype dayCount = origin.daysTo(last) + 1;
+
+    // A new first day shifts every index; otherwise only the edited suffix
+    // and any days added since (e.g. the calendar moved on) are stale
+    if (m_timeline.isEmpty() || m_timeline.first().date != origin) {
+        m_timeline.clear();
+        m_dirtyFrom = origin;
+    } else if (dayCount > m_timeline.size()) {
+        QDate firstNew = origin.addDays(m_timeline.size());
+        if (!m_dirtyFrom.isValid() || firstNew < m_dirtyFrom) {
+            m_dirtyFrom = firstNew;
+        }
+    }
+    m_timeline.resize(dayCount);
+
+    if (m_needsFit) {
+        QList<double> load(dayCount, 0.0);
+        for (auto it = m_dailyLoad.constBegin(); it != m_dailyLoad.constEnd(); ++it) {
+            load[origin.daysTo(it.key())] = it->load;
+        }
+        m_parameters = fit(load, performanceObservations(origin, dayCount));
+        m_needsFit = false;
+
+        // New time constants and gains change every day of the model
+        m_dirtyFrom = origin;
+    }
+
+    if (m_dirtyFrom.isValid()) {
+        recomputeFrom(qMax<qint64>(0, origin.daysTo(m_dirtyFrom)));
+        m_dirtyFrom = QDate();
+    }
+}
+
+void TrainingLoad::recomputeFrom(qsizetype first) const
+{
+    const qsizetype dayCount = m_timeline.size();
+    if (first >= dayCount) {
+        return;
+    }
+
+    // Reload the daily loads of the suffix
+    const QDate origin = m_dailyLoad.firstKey();
+    for (qsizetype i = first; i < dayCount; ++i) {
+        m_timeline[i].date = origin.addDays(i);
+        m_timeline[i].load = 0.0;
+    }
+    for (auto it = m_dailyLoad.lowerBound(origin.addDays(first)); it != m_dailyLoad.constEnd(); ++it) {
+        m_timeline[origin.daysTo(it.key())].load = it->load;
+    }
+
+    const double fitnessRetention = qExp(-1.0 / m_parameters.fitnessDecay);
+    const double fatigueRetention = qExp(-1.0 / m_parameters.fatigueDecay);
+
+    // Resume the rolling sums with the windows ending the day before
+    double acuteSum = 0.0;
+    double chronicSum = 0.0;
+    for (qsizetype i = qMax<qsizetype>(0, first - ChronicDays); i < first; ++i) {
+        chronicSum += m_timeline.at(i).load;
+        if (i >= first - AcuteDays) {
+            acuteSum += m_timeline.at(i).load;
+        }
+    }
+    double fitness = first > 0 ? m_timeline.at(first - 1).fitness : 0.0;
+    double fatigue = first > 0 ? m_timeline.at(first - 1).fatigue : 0.0;
+
+    // Rolling sums: each day adds the newest load and drops the one leaving the window
+    for (qsizetype i = first; i < dayCount; ++i) {
+        Day &day = m_timeline[i];
+        acuteSum += day.load;
+        chronicSum += day.load;
+        if (i >= AcuteDays) {
+            acuteSum -= m_timeline.at(i - AcuteDays).load;
+        }
+        if (i >= ChronicDays) {
+            chronicSum -= m_timeline.at(i - ChronicDays).load;
+        }
+        fitness = fitness * fitnessRetention + day.load;
+        fatigue = fatigue * fatigueRetention + day.load;
+
+        day.acute = qMax(0.0, acuteSum) / AcuteDays;
+        day.chronic = qMax(0.0, chronicSum) / ChronicDays;
+        day.ratio = day.chronic > 1e-9 ? day.acute / day.chronic : 0.0;
+        day.fitness = fitness;
+        day.fatigue = fatigue;
+        day.performance = m_parameters.p0 + m_parameters.k1 * fitness - m_parameters.k2 * fatigue;
+    }
+}
+
+QList<QPair<int, double>> TrainingLoad::performanceObservations(const QDate &origin, int dayCount) const
+{
+    // Per day: average over exercises of the session's e1RM as a percentage
+    // of that exercise's best, so different lifts share one scale
+    QMap<int, QPair<double, int>> byDay;
+    for (int exerciseId : m_sessions->exerciseIds()) {
+        const QList<StrengthIndex::Session> sessions = m_sessions->sessions(exerciseId);
+
+        double best = 0.0;
+        for (const StrengthIndex::Session &session : sessions) {
+            best = qMax(best, session.bestEpley);
+        }
+        if (best <= 0.0) {
+            continue;
+        }
+
+        for (const StrengthIndex::Session &session : sessions) {
+            qint64 day = origin.daysTo(session.date);
+            if (day < 0 || day >= dayCount || session.bestEpley <= 0.0) {
+                continue;
+            }
+            QPair<double, int> &entry = byDay[static_cast<int>(day)];
+            entry.first += session.bestEpley / best * 100.0;
+            entry.second += 1;
+        }
+    }
+
+    QList<QPair<int, double>> observations;
+    observations.reserve(byDay.size());
+    for (auto it = byDay.constBegin(); it != byDay.constEnd(); ++it) {
+        observations.append(qMakePair(it.key(), it.value().first / it.value().second));
+    }
+    return observations;
+}
@@ -0,0 +1,104 @@
+#ifndef TRAININGLOAD_H
+#define TRAININGLOAD_H
+
+#include <QDate>
+#include <QList>
+#include <QMap>
+#include <QPair>
+#include "workout.h"
+#include "strengthindex.h"
+
+// Training load engine over the workout history. Daily load is the volume
+// lifted that day in tonnes (weight × reps × sets / 1000). From it we derive
+// the acute:chronic workload ratio (7-day over 28-day rolling mean) and the
+// Banister impulse-response model:
+//
+//     fitness(t)     = fitness(t-1) · e^(-1/τ1) + load(t)
+//     fatigue(t)     = fatigue(t-1) · e^(-1/τ2) + load(t)
+//     performance(t) = p0 + k1 · fitness(t) - k2 · fatigue(t)
+//
+// The model is fitted against observed performance, taken as the day's
+// average estimated 1RM relative to each exercise's best. Time constants
+// are grid-searched in parallel; for each (τ1, τ2) the gains come from a
+// linear least-squares solve.
+//
+// Daily loads are patched per workout. On the next query the dense
+// timeline is recomputed from the earliest edited day forward only: the
+// rolling sums and fitness/fatigue recurrences resume from the day before.
+// The fit scans the whole history for every grid point, so it runs only
+// when the model is first queried and on refit(); edits in between keep
+// the fitted parameters and mark them stale.
+class TrainingLoad
+{
+public:
+    struct Parameters {
+        double p0 = 0.0;
+        double k1 = 1.0;
+        double k2 = 2.0;
+        double fitnessDecay = 42.0;    // τ1, days
+        double fatigueDecay = 7.0;     // τ2, days
+        double rss = 0.0;              // residual sum of squares of the fit
+        int observations = 0;
+        bool fitted = false;           // false: not enough history, defaults in use
+        bool stale = false;            // workouts changed since the fit
+    };
+
+    struct Day {
+        QDate date;
+        double load = 0.0;
+        double acute = 0.0;      // 7-day mean load
+        double chronic = 0.0;    // 28-day mean load
+        double ratio = 0.0;      // acute:chronic, 0 until there is chronic load
+        double fitness = 0.0;
+        double fatigue = 0.0;
+        double performance = 0.0;
+    };
+
+    static const int AcuteDays = 7;
+    static const int ChronicDays = 28;
+
+    explicit TrainingLoad(const StrengthIndex *sessions);
+
+    // Maintenance
+    void rebuild(const QMap<int, Workout> &workouts);
+    void addWorkout(const Workout &workout);
+    void removeWorkout(const Workout &workout);
+    void clear();
+
+    // Fits the model again on the next query
+    void refit();
+
+    // Dense day-by-day timeline through today. An invalid start or end date
+    // leaves that side of the range open.
+    QList<Day> days(const QDate &start = QDate(), const QDate &end = QDate()) const;
+    Parameters parameters() const;
+
+    static double workoutLoad(const Workout &workout);
+
+    // Fits the Banister model to observations given as (day index into load, value)
+    static Parameters fit(const QList<double> &load, const QList<QPair<int, double>> &observations);
+
+private:
+    // Workouts are counted so a day whose workouts all lift nothing still
+    // goes away when the last of them is removed
+    struct DailyLoad {
+        double load = 0.0;
+        int workouts = 0;
+    };
+
+    void markDirty(const QDate &date);
+    void ensureComputed() const;
+    void recomputeFrom(qsizetype first) const;
+    QList<QPair<int, double>> performanceObservations(const QDate &origin, int dayCount) const;
+
+    const StrengthIndex *m_sessions;
+    QMap<QDate, DailyLoad> m_dailyLoad;
+
+    // Derived lazily, hence mutable
+    mutable QList<Day> m_timeline;
+    mutable QDate m_dirtyFrom;        // earliest day to recompute; invalid when current
+    mutable bool m_needsFit;
+    mutable Parameters m_parameters;
+};
+
+#endif // TRAININGLOAD_H
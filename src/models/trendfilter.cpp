@@ -0,0 +1,144 @@
+#include "trendfilter.h"
+#include <QtMath>
+#include <algorithm>
+
+TrendFilter::TrendFilter(BodyCompositionIndex::Metric metric)
+    : m_metric(metric)
+    , m_parameters(defaultParameters(metric))
+{
+}
+
+TrendFilter::TrendFilter(BodyCompositionIndex::Metric metric, const Parameters &parameters)
+    : m_metric(metric)
+    , m_parameters(parameters)
+{
+}
+
+TrendFilter::Parameters TrendFilter::defaultParameters(BodyCompositionIndex::Metric metric)
+{
+    switch (metric) {
+        case BodyCompositionIndex::BodyFat:
+            // Tape-test body fat is noisy relative to how slowly it changes
+            return Parameters{0.1, 0.01, 1.0};
+        case BodyCompositionIndex::Weight:
+        default:
+            // Daily weigh-ins swing 1-2 lbs around a slowly moving true weight
+            return Parameters{0.1, 0.05, 2.25};
+    }
+}
+
+void TrendFilter::rebuild(const QMap<QDate, BodyComposition> &data)
+{
+    m_points.clear();
+    m_points.reserve(data.size());
+
+    for (auto it = data.constBegin(); it != data.constEnd(); ++it) {
+        double value = BodyCompositionIndex::metricValue(it.value(), m_metric);
+        if (value > 0.0) {
+            Point point;
+            point.date = it.key();
+            point.value = value;
+            m_points.append(point);
+        }
+    }
+
+    recomputeFrom(0);
+}
+
+void TrendFilter::upsert(const BodyComposition &composition)
+{
+    if (!composition.date().isValid()) {
+        return;
+    }
+
+    int position = positionOf(composition.date());
+    bool exists = position < m_points.size() && m_points.at(position).date == composition.date();
+    double value = BodyCompositionIndex::metricValue(composition, m_metric);
+
+    // An entry without this measurement drops out of the trend
+    if (value <= 0.0) {
+        if (exists) {
+            m_points.removeAt(position);
+            recomputeFrom(position);
+        }
+        return;
+    }
+
+    if (exists) {
+        m_points[position].value = value;
+    } else {
+        Point point;
+        point.date = composition.date();
+        point.value = value;
+        m_points.insert(position, point);
+    }
+
+    recomputeFrom(position);
+}
+
+void TrendFilter::remove(const QDate &date)
+{
+    int position = positionOf(date);
+    if (position < m_points.size() && m_points.at(position).date == date) {
+        m_points.removeAt(position);
+        recomputeFrom(position);
+    }
+}
+
+void TrendFilter::clear()
+{
+    m_points.clear();
+}
+
+QList<TrendFilter::Point> TrendFilter::points(const QDate &start, const QDate &end) const
+{
+    int first = start.isValid() ? positionOf(start) : 0;
+    int last = m_points.size();
+    if (end.isValid()) {
+        last = std::upper_bound(m_points.constBegin(), m_points.constEnd(), end,
+                                [](const QDate &date, const Point &point) {
+                                    return date < point.date;
+                                }) - m_points.constBegin();
+    }
+
+    if (first >= last) {
+        return QList<Point>();
+    }
+    return m_points.mid(first, last - first);
+}
+
+int TrendFilter::positionOf(const QDate &date) const
+{
+    return std::lower_bound(m_points.constBegin(), m_points.constEnd(), date,
+                            [](const Point &point, const QDate &value) {
+                                return point.date < value;
+                            }) - m_points.constBegin();
+}
+
+void TrendFilter::recomputeFrom(int position)
+{
+    for (int i = position; i < m_points.size(); ++i) {
+        Point &point = m_points[i];
+
+        if (i == 0) {
+            // The first reading seeds both filters
+            point.ewma = point.value;
+            point.kalman = point.value;
+            point.kalmanVariance = m_parameters.measurementNoise;
+            continue;
+        }
+
+        const Point &previous = m_points.at(i - 1);
+        double elapsedDays = qMax<qint64>(1, previous.date.daysTo(point.date));
+
+        // EWMA: a gap of n days decays the old trend as n daily steps would
+        double alpha = 1.0 - qPow(1.0 - m_parameters.ewmaAlpha, elapsedDays);
+        point.ewma = previous.ewma + alpha * (point.value - previous.ewma);
+
+        // Kalman: random walk whose uncertainty grows with the gap
+        double predictedVariance = previous.kalmanVariance + m_parameters.processNoise * elapsedDays;
+        double gain = predictedVariance / (predictedVariance + m_parameters.measurementNoise);
+        point.kalman = previous.kalman + gain * (point.value - previous.kalman);
+        point.kalmanVariance = (1.0 - gain) * predictedVariance;
+    }
+}
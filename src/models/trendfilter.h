@@ -0,0 +1,66 @@
+#ifndef TRENDFILTER_H
+#define TRENDFILTER_H
+
+#include <QDate>
+#include <QList>
+#include <QMap>
+#include "bodycomposition.h"
+#include "bodycompositionindex.h"
+
+// Smoothed trend line over one body composition metric. Both an
+// exponentially weighted moving average and a random-walk Kalman filter are
+// tracked per entry, so switching method needs no recomputation.
+//
+// State is kept per entry: appending the latest day is O(1), and editing or
+// removing an older day only re-runs the filters from that date forward.
+class TrendFilter
+{
+public:
+    enum Method {
+        EWMA,
+        Kalman
+    };
+
+    struct Parameters {
+        double ewmaAlpha;           // Smoothing per day of elapsed time
+        double processNoise;        // Kalman: variance the true value drifts per day
+        double measurementNoise;    // Kalman: variance of a single reading
+    };
+
+    struct Point {
+        QDate date;
+        double value = 0.0;
+        double ewma = 0.0;
+        double kalman = 0.0;
+        double kalmanVariance = 0.0;
+
+        double estimate(Method method) const { return method == Kalman ? kalman : ewma; }
+    };
+
+    explicit TrendFilter(BodyCompositionIndex::Metric metric = BodyCompositionIndex::Weight);
+    TrendFilter(BodyCompositionIndex::Metric metric, const Parameters &parameters);
+
+    // Maintenance
+    void rebuild(const QMap<QDate, BodyComposition> &data);
+    void upsert(const BodyComposition &composition);
+    void remove(const QDate &date);
+    void clear();
+
+    // Queries. An invalid start or end date leaves that side of the range open.
+    BodyCompositionIndex::Metric metric() const { return m_metric; }
+    Parameters parameters() const { return m_parameters; }
+    int size() const { return m_points.size(); }
+    QList<Point> points(const QDate &start = QDate(), const QDate &end = QDate()) const;
+
+    static Parameters defaultParameters(BodyCompositionIndex::Metric metric);
+
+private:
+    int positionOf(const QDate &date) const;
+    void recomputeFrom(int position);
+
+    BodyCompositionIndex::Metric m_metric;
+    Parameters m_parameters;
+    QList<Point> m_points;
+};
+
+#endif // TRENDFILTER_H
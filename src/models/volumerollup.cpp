@@ -0,0 +1,138 @@
+#include "volumerollup.h"
+#include <algorithm>
+
+VolumeRollup::Totals &VolumeRollup::Totals::operator+=(const Totals &other)
+{
+    sets += other.sets;
+    reps += other.reps;
+    volume += other.volume;
+    return *this;
+}
+
+VolumeRollup::Totals &VolumeRollup::Totals::operator-=(const Totals &other)
+{
+    sets -= other.sets;
+    reps -= other.reps;
+    volume -= other.volume;
+    return *this;
+}
+
+QString VolumeRollup::categoryOf(int exerciseId) const
+{
+    QString category = m_categories.value(exerciseId);
+    return category.isEmpty() ? QString("Uncategorized") : category;
+}
+
+void VolumeRollup::rebuild(const QMap<int, Workout> &workouts)
+{
+    m_weeks.clear();
+    m_months.clear();
+    m_categoryUse.clear();
+    for (auto it = workouts.constBegin(); it != workouts.constEnd(); ++it) {
+        addWorkout(it.value());
+    }
+}
+
+void VolumeRollup::addWorkout(const Workout &workout)
+{
+    apply(workout, true);
+}
+
+void VolumeRollup::removeWorkout(const Workout &workout)
+{
+    apply(workout, false);
+}
+
+void VolumeRollup::clear()
+{
+    m_categories.clear();
+    m_weeks.clear();
+    m_months.clear();
+    m_categoryUse.clear();
+}
+
+QList<VolumeRollup::Bucket> VolumeRollup::buckets(Period period, const QDate &start, const QDate &end) const
+{
+    const QMap<QDate, QHash<QString, Totals>> &rollup = period == Week ? m_weeks : m_months;
+
+    QList<Bucket> result;
+    auto it = start.isValid() ? rollup.lowerBound(periodStart(start, period)) : rollup.constBegin();
+    for (; it != rollup.constEnd(); ++it) {
+        if (end.isValid() && it.key() > end) {
+            break;
+        }
+        result.append({it.key(), it.value()});
+    }
+    return result;
+}
+
+QStringList VolumeRollup::categories() const
+{
+    QStringList result = m_categoryUse.keys();
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+QDate VolumeRollup::periodStart(const QDate &date, Period period)
+{
+    if (period == Week) {
+        return date.addDays(1 - date.dayOfWeek());
+    }
+    return QDate(date.year(), date.month(), 1);
+}
+
+QHash<QString, VolumeRollup::Totals> VolumeRollup::summarize(const Workout &workout) const
+{
+    QHash<QString, Totals> totals;
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        Totals exerciseTotals;
+        for (const SetData &set : exercise.setsData()) {
+            if (!set.isValid()) {
+                continue;
+            }
+            exerciseTotals.sets += set.sets();
+            exerciseTotals.reps += set.reps() * set.sets();
+            exerciseTotals.volume += set.weight() * set.reps() * set.sets();
+        }
+        if (!exerciseTotals.isEmpty()) {
+            totals[categoryOf(exercise.exerciseId())] += exerciseTotals;
+        }
+    }
+    return totals;
+}
+
+void VolumeRollup::apply(const Workout &workout, bool add)
+{
+    if (!workout.date().isValid()) {
+        return;
+    }
+
+    const QHash<QString, Totals> totals = summarize(workout);
+    for (Period period : {Week, Month}) {
+        QHash<QString, Totals> &bucket = (period == Week ? m_weeks : m_months)[periodStart(workout.date(), period)];
+
+        for (auto it = totals.constBegin(); it != totals.constEnd(); ++it) {
+            Totals &categoryTotals = bucket[it.key()];
+            bool wasEmpty = categoryTotals.isEmpty();
+            if (add) {
+                categoryTotals += it.value();
+            } else {
+                categoryTotals -= it.value();
+            }
+
+            // Set counts are exact, so an emptied category really is gone
+            if (categoryTotals.isEmpty()) {
+                bucket.remove(it.key());
+                if (!wasEmpty && --m_categoryUse[it.key()] == 0) {
+                    m_categoryUse.remove(it.key());
+                }
+            } else if (wasEmpty) {
+                ++m_categoryUse[it.key()];
+            }
+        }
+
+        if (bucket.isEmpty()) {
+            (period == Week ? m_weeks : m_months).remove(periodStart(workout.date(), period));
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef VOLUMEROLLUP_H
+#define VOLUMEROLLUP_H
+
+#include <QDate>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include "workout.h"
+
+// Materialized training totals (sets, reps, volume) per period and exercise
+// category, kept for ISO weeks and calendar months. Saving or deleting a
+// workout adds or subtracts only that workout's totals, so summaries over
+// years of history are a lookup rather than a scan of every workout.
+class VolumeRollup
+{
+public:
+    enum Period {
+        Week,
+        Month
+    };
+
+    struct Totals {
+        int sets = 0;
+        int reps = 0;
+        double volume = 0.0;    // weight × reps × sets
+
+        bool isEmpty() const { return sets == 0; }
+        Totals &operator+=(const Totals &other);
+        Totals &operator-=(const Totals &other);
+    };
+
+    struct Bucket {
+        QDate periodStart;
+        QHash<QString, Totals> byCategory;
+    };
+
+    // Exercise categories. Workouts are bucketed by the category their
+    // exercises have when they are added, so a category change needs a rebuild.
+    void setCategories(const QHash<int, QString> &categories) { m_categories = categories; }
+    void setCategory(int exerciseId, const QString &category) { m_categories[exerciseId] = category; }
+    void removeCategory(int exerciseId) { m_categories.remove(exerciseId); }
+    QString categoryOf(int exerciseId) const;
+
+    // Maintenance
+    void rebuild(const QMap<int, Workout> &workouts);
+    void addWorkout(const Workout &workout);
+    void removeWorkout(const Workout &workout);
+    void clear();
+
+    // Queries. An invalid start or end date leaves that side of the range open.
+    QList<Bucket> buckets(Period period, const QDate &start = QDate(), const QDate &end = QDate()) const;
+    QStringList categories() const;
+
+    // Monday of the ISO week, or the first of the month
+    static QDate periodStart(const QDate &date, Period period);
+
+private:
+    QHash<QString, Totals> summarize(const Workout &workout) const;
+    void apply(const Workout &workout, bool add);
+
+    QHash<int, QString> m_categories;
+    QMap<QDate, QHash<QString, Totals>> m_weeks;
+    QMap<QDate, QHash<QString, Totals>> m_months;
+    QHash<QString, int> m_categoryUse;  // buckets each category appears in
+};
+
+#endif // VOLUMEROLLUP_H
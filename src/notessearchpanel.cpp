@@ -0,0 +1,127 @@
+#include "notessearchpanel.h"
+#include <QVBoxLayout>
+#include <QElapsedTimer>
+
+namespace {
+constexpr int kMaxResults = 200;
+
+enum ItemRoles {
+    DateRole = Qt::UserRole,
+    SourceRole
+};
+}
+
+NotesSearchPanel::NotesSearchPanel(DataManager *dataManager, QWidget *parent)
+    : QWidget(parent)
+    , m_dataManager(dataManager)
+    , m_searchEdit(nullptr)
+    , m_statusLabel(nullptr)
+    , m_resultsList(nullptr)
+    , m_refreshPending(false)
+{
+    setupUI();
+    
+    // Keep results current as entries are saved or deleted
+    connect(m_dataManager, &DataManager::dataChanged, this, &NotesSearchPanel::onDataChanged);
+}
+
+void NotesSearchPanel::setupUI()
+{
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+    
+    m_searchEdit = new QLineEdit();
+    m_searchEdit->setPlaceholderText("Search notes (e.g. shoulder, deload)...");
+    m_searchEdit->setClearButtonEnabled(true);
+    
+    m_statusLabel = new QLabel();
+    m_statusLabel->setStyleSheet("QLabel { color: #666; }");
+    
+    m_resultsList = new QListWidget();
+    m_resultsList->setWordWrap(true);
+    m_resultsList->setUniformItemSizes(false);
+    
+    mainLayout->addWidget(m_searchEdit);
+    mainLayout->addWidget(m_statusLabel);
+    mainLayout->addWidget(m_resultsList, 1);
+    
+    connect(m_searchEdit, &QLineEdit::textChanged, this, &NotesSearchPanel::refresh);
+    connect(m_resultsList, &QListWidget::itemActivated, this, &NotesSearchPanel::onItemActivated);
+}
+
+void NotesSearchPanel::focusSearch()
+{
+    m_searchEdit->setFocus();
+    m_searchEdit->selectAll();
+}
+
+void NotesSearchPanel::refresh()
+{
+    m_refreshPending = false;
+    m_resultsList->clear();
+    
+    QString query = m_searchEdit->text();
+    if (NotesIndex::tokenize(query).isEmpty()) {
+        m_statusLabel->clear();
+        return;
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    const QList<NotesIndex::Match> matches = m_dataManager->searchNotes(query, kMaxResults);
+    double elapsedMs = timer.nsecsElapsed() / 1e6;
+    
+    for (const NotesIndex::Match &match : matches) {
+        QListWidgetItem *item = new QListWidgetItem(QString("%1 · %2\n%3")
+                                                        .arg(match.date.toString("ddd, MMM d, yyyy"))
+                                                        .arg(sourceLabel(match))
+                                                        .arg(match.text));
+        item->setData(DateRole, match.date);
+        item->setData(SourceRole, int(match.source));
+        m_resultsList->addItem(item);
+    }
+    
+    QString countText = matches.size() >= kMaxResults
+                            ? QString("First %1 matches").arg(kMaxResults)
+                            : QString("%1 match%2").arg(matches.size()).arg(matches.size() == 1 ? "" : "es");
+    m_statusLabel->setText(QString("%1 (%2 ms)").arg(countText).arg(elapsedMs, 0, 'f', 2));
+}
+
+void NotesSearchPanel::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    if (m_refreshPending) {
+        refresh();
+    }
+}
+
+void NotesSearchPanel::onDataChanged()
+{
+    // Searching is wasted while the dock is closed; catch up when it opens
+    if (!isVisible()) {
+        m_refreshPending = true;
+        return;
+    }
+    refresh();
+}
+
+void NotesSearchPanel::onItemActivated(QListWidgetItem *item)
+{
+    if (!item) {
+        return;
+    }
+    emit matchActivated(item->data(DateRole).toDate(),
+                        NotesIndex::Source(item->data(SourceRole).toInt()));
+}
+
+QString NotesSearchPanel::sourceLabel(const NotesIndex::Match &match)
+{
+    switch (match.source) {
+    case NotesIndex::BodyCompositionNote:
+        return "Body composition";
+    case NotesIndex::WorkoutNote:
+        return "Workout";
+    case NotesIndex::ExerciseNote:
+        return match.context.isEmpty() ? QString("Exercise") : match.context;
+    }
+    return QString();
+}
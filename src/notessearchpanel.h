@@ -0,0 +1,49 @@
+#ifndef NOTESSEARCHPANEL_H
+#define NOTESSEARCHPANEL_H
+
+#include <QWidget>
+#include <QLineEdit>
+#include <QLabel>
+#include <QListWidget>
+#include "models/datamanager.h"
+
+// Search box over every note in the journal. Results are listed newest first;
+// activating one reports its date so the journal can jump there.
+class NotesSearchPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit NotesSearchPanel(DataManager *dataManager, QWidget *parent = nullptr);
+
+    void focusSearch();
+
+signals:
+    void matchActivated(const QDate &date, NotesIndex::Source source);
+
+public slots:
+    void refresh();
+
+protected:
+    void showEvent(QShowEvent *event) override;
+
+private slots:
+    void onDataChanged();
+    void onItemActivated(QListWidgetItem *item);
+
+private:
+    void setupUI();
+    static QString sourceLabel(const NotesIndex::Match &match);
+
+    DataManager *m_dataManager;
+
+    // UI Components
+    QLineEdit *m_searchEdit;
+    QLabel *m_statusLabel;
+    QListWidget *m_resultsList;
+
+    // Data changed while the panel was hidden; refresh when shown
+    bool m_refreshPending;
+};
+
+#endif // NOTESSEARCHPANEL_H
@@ -0,0 +1,84 @@
+#include "seriesupdater.h"
+
+void SeriesUpdater::apply(QXYSeries *series, const QList<QPointF> &points)
+{
+    if (!series) {
+        return;
+    }
+
+    // Empty on either side: nothing to diff against
+    if (series->count() == 0 || points.isEmpty()) {
+        if (series->count() != 0 || !points.isEmpty()) {
+            series->replace(points);
+        }
+        return;
+    }
+
+    int edits = countEdits(series->points(), points);
+    if (edits == 0) {
+        return;
+    }
+
+    // Patching point by point only pays off for small changes
+    if (edits * 2 > points.size()) {
+        series->replace(points);
+        return;
+    }
+
+    // Merge walk over both x-sorted sequences, patching the series in place
+    int i = 0;
+    int j = 0;
+    while (j < points.size()) {
+        if (i >= series->count()) {
+            series->append(points.mid(j));
+            return;
+        }
+
+        const QPointF current = series->at(i);
+        const QPointF &target = points.at(j);
+
+        if (current.x() == target.x()) {
+            if (current.y() != target.y()) {
+                series->replace(i, target);
+            }
+            ++i;
+            ++j;
+        } else if (current.x() < target.x()) {
+            series->remove(i);
+        } else {
+            series->insert(i, target);
+            ++i;
+            ++j;
+        }
+    }
+
+    if (i < series->count()) {
+        series->removePoints(i, series->count() - i);
+    }
+}
+
+int SeriesUpdater::countEdits(const QList<QPointF> &current, const QList<QPointF> &target)
+{
+    int edits = 0;
+    int i = 0;
+    int j = 0;
+    while (i < current.size() && j < target.size()) {
+        const QPointF &a = current.at(i);
+        const QPointF &b = target.at(j);
+        if (a.x() == b.x()) {
+            if (a.y() != b.y()) {
+                ++edits;
+            }
+            ++i;
+            ++j;
+        } else if (a.x() < b.x()) {
+            ++edits;
+            ++i;
+        } else {
+            ++edits;
+            ++j;
+        }
+    }
+
+    return edits + (current.size() - i) + (target.size() - j);
+}
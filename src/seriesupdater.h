@@ -0,0 +1,20 @@
+#ifndef SERIESUPDATER_H
+#define SERIESUPDATER_H
+
+#include <QList>
+#include <QPointF>
+#include <QtCharts/QXYSeries>
+
+class SeriesUpdater
+{
+public:
+    // Brings a series in line with the given points (sorted by x) by applying
+    // only the inserts, updates and removals that differ from what is shown.
+    // When most of the series would change anyway, a single replace() is used.
+    static void apply(QXYSeries *series, const QList<QPointF> &points);
+
+private:
+    static int countEdits(const QList<QPointF> &current, const QList<QPointF> &target);
+};
+
+#endif // SERIESUPDATER_H
@@ -0,0 +1,236 @@
+#include "stallwatchdog.h"
+#include "utils/logging.h"
+#include "utils/trace.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStringList>
+#include <QTextStream>
+#include <chrono>
+
+#if defined(Q_OS_LINUX) && defined(__GLIBC__)
+#define STALLWATCHDOG_STACK_SAMPLES
+#include <execinfo.h>
+#include <pthread.h>
+#include <signal.h>
+#include <cstdlib>
+#endif
+
+namespace {
+
+#ifdef STALLWATCHDOG_STACK_SAMPLES
+// The GUI thread captures its own stack when interrupted by SampleSignal;
+// backtrace() is warmed up once beforehand so the handler doesn't allocate.
+//
+// Each request carries a generation that the handler publishes together
+// with the frame count, so an answer arriving after the watchdog gave up
+// waiting is never taken for a later request. No new request goes out
+// while one is unanswered, since its handler may still write s_frames.
+constexpr int SampleSignal = SIGUSR2;
+constexpr int MaxFrames = 48;
+void *s_frames[MaxFrames];
+std::atomic<quint32> s_requestedGeneration{0};
+std::atomic<quint64> s_published{0};  // generation << 32 | frame count
+pthread_t s_guiThread;
+
+quint32 publishedGeneration(quint64 published)
+{
+    return quint32(published >> 32);
+}
+
+void sampleHandler(int)
+{
+    quint32 generation = s_requestedGeneration.load(std::memory_order_acquire);
+    int count = backtrace(s_frames, MaxFrames);
+    s_published.store((quint64(generation) << 32) | quint32(qMax(0, count)), std::memory_order_release);
+}
+
+void installSampler()
+{
+    void *warmUp[1];
+    backtrace(warmUp, 1);
+    s_guiThread = pthread_self();
+
+    struct sigaction action = {};
+    action.sa_handler = sampleHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SampleSignal, &action, nullptr);
+}
+
+QStringList sampleGuiStack()
+{
+    QStringList frames;
+    const quint32 previous = s_requestedGeneration.load(std::memory_order_relaxed);
+    if (publishedGeneration(s_published.load(std::memory_order_acquire)) != previous) {
+        // The GUI thread hasn't handled the last request yet
+        return frames;
+    }
+
+    const quint32 generation = previous + 1;
+    s_requestedGeneration.store(generation, std::memory_order_release);
+    if (pthread_kill(s_guiThread, SampleSignal) != 0) {
+        // Nothing will answer, so close the request here
+        s_published.store(quint64(generation) << 32, std::memory_order_relaxed);
+        return frames;
+    }
+
+    // The handler runs as soon as the kernel schedules the GUI thread
+    quint64 published = s_published.load(std::memory_order_acquire);
+    for (int i = 0; i < 50 && publishedGeneration(published) != generation; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        published = s_published.load(std::memory_order_acquire);
+    }
+
+    int count = int(published & 0xFFFFFFFFULL);
+    if (publishedGeneration(published) != generation || count <= 0) {
+        return frames;
+    }
+
+    char **symbols = backtrace_symbols(s_frames, count);
+    // Skip the handler and the signal trampoline
+    for (int i = 2; i < count; ++i) {
+        frames.append(symbols ? QString::fromLocal8Bit(symbols[i])
+                              : QString("0x%1").arg(quintptr(s_frames[i]), 0, 16));
+    }
+    free(symbols);
+    return frames;
+}
+#else
+void installSampler()
+{
+}
+
+QStringList sampleGuiStack()
+{
+    return QStringList();
+}
+#endif
+
+} // namespace
+
+StallWatchdog::StallWatchdog(int thresholdMs, const QString &logFilePath, QObject *parent)
+    : QObject(parent)
+    , m_thresholdMs(qMax(1, thresholdMs))
+    , m_logFilePath(logFilePath)
+    , m_guiThreadId(Trace::currentThreadId())
+    , m_heartbeat(nullptr)
+    , m_lastBeatNs(0)
+    , m_running(false)
+{
+    // Beat a few times per threshold so detection lags by at most a quarter
+    m_heartbeat = new QTimer(this);
+    m_heartbeat->setInterval(qMax(10, m_thresholdMs / 4));
+    connect(m_heartbeat, &QTimer::timeout, this, [this]() {
+        m_lastBeatNs.store(Trace::nowNs(), std::memory_order_relaxed);
+    });
+}
+
+StallWatchdog::~StallWatchdog()
+{
+    stop();
+}
+
+void StallWatchdog::start()
+{
+    if (m_running) {
+        return;
+    }
+
+    installSampler();
+    Trace::setSpanStackEnabled(true);
+    m_lastBeatNs.store(Trace::nowNs(), std::memory_order_relaxed);
+    m_heartbeat->start();
+
+    m_running = true;
+    m_thread = std::thread(&StallWatchdog::run, this);
+    qCInfo(lcUi) << "Stall watchdog started:" << m_thresholdMs << "ms threshold, log" << m_logFilePath;
+}
+
+void StallWatchdog::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) {
+            return;
+        }
+        m_running = false;
+    }
+    m_wake.notify_all();
+    m_thread.join();
+
+    m_heartbeat->stop();
+    Trace::setSpanStackEnabled(false);
+}
+
+void StallWatchdog::run()
+{
+    const qint64 thresholdNs = qint64(m_thresholdMs) * 1000000;
+    const auto pollInterval = std::chrono::milliseconds(qMax(5, m_thresholdMs / 4));
+    qint64 stalledSince = -1;  // heartbeat stamp of the stall being tracked
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running) {
+        m_wake.wait_for(lock, pollInterval);
+        if (!m_running) {
+            break;
+        }
+
+        qint64 lastBeat = m_lastBeatNs.load(std::memory_order_relaxed);
+        qint64 now = Trace::nowNs();
+
+        if (stalledSince >= 0 && lastBeat != stalledSince) {
+            // The loop is running again; the beat that just landed ends it
+            reportRecovery(lastBeat - stalledSince);
+            stalledSince = -1;
+        } else if (stalledSince < 0 && now - lastBeat > thresholdNs) {
+            stalledSince = lastBeat;
+            reportStall(now - lastBeat);
+        }
+    }
+}
+
+void StallWatchdog::reportStall(qint64 stalledNs)
+{
+    QStringList spans = Trace::activeSpans(m_guiThreadId);
+    QStringList stack = sampleGuiStack();
+
+    QString text;
+    QTextStream out(&text);
+    out << QDateTime::currentDateTime().toString(Qt::ISODateWithMs)
+        << " UI stalled for " << stalledNs / 1000000 << " ms (threshold " << m_thresholdMs << " ms)\n";
+    out << "  active spans: " << (spans.isEmpty() ? QString("(none)") : spans.join(" > ")) << "\n";
+    if (!stack.isEmpty()) {
+        out << "  stack:\n";
+        for (const QString &frame : stack) {
+            out << "    " << frame << "\n";
+        }
+    }
+    out.flush();
+
+    qCWarning(lcUi).noquote() << "UI stalled for" << stalledNs / 1000000 << "ms in"
+                              << (spans.isEmpty() ? QString("(no span)") : spans.join(" > "));
+    writeLog(text);
+}
+
+void StallWatchdog::reportRecovery(qint64 stalledNs)
+{
+    writeLog(QString("%1 UI stall ended after %2 ms\n")
+             .arg(QDateTime::currentDateTime().toString(Qt::ISODateWithMs))
+             .arg(stalledNs / 1000000));
+}
+
+void StallWatchdog::writeLog(const QString &text)
+{
+    if (m_logFilePath.isEmpty()) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_logFilePath).absolutePath());
+    QFile file(m_logFilePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+        return;
+    }
+    file.write(text.toUtf8());
+}
@@ -0,0 +1,51 @@
+#ifndef STALLWATCHDOG_H
+#define STALLWATCHDOG_H
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Detects GUI event-loop stalls. A heartbeat timer on the GUI thread stamps
+// the time whenever the loop is free; a background thread checks the stamp
+// and, once it is older than the threshold, logs the GUI thread's open
+// trace spans and (on Linux/glibc) a stack sample. The end of each stall is
+// logged with its total duration.
+//
+// Create and start on the GUI thread.
+class StallWatchdog : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit StallWatchdog(int thresholdMs, const QString &logFilePath, QObject *parent = nullptr);
+    ~StallWatchdog() override;
+
+    void start();
+    void stop();
+
+    int thresholdMs() const { return m_thresholdMs; }
+    QString logFilePath() const { return m_logFilePath; }
+
+private:
+    void run();
+    void reportStall(qint64 stalledNs);
+    void reportRecovery(qint64 stalledNs);
+    void writeLog(const QString &text);
+
+    int m_thresholdMs;
+    QString m_logFilePath;
+    int m_guiThreadId;
+    QTimer *m_heartbeat;
+    std::atomic<qint64> m_lastBeatNs;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_running;
+};
+
+#endif // STALLWATCHDOG_H
@@ -0,0 +1,56 @@
+#include "startuptimer.h"
+#include "utils/logging.h"
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QObject>
+#include <QWidget>
+
+namespace {
+
+QElapsedTimer s_clock;
+qint64 s_lastMarkNs = 0;
+
+class FirstPaintFilter : public QObject
+{
+public:
+    explicit FirstPaintFilter(QObject *parent)
+        : QObject(parent)
+    {
+    }
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        if (event->type() == QEvent::Paint) {
+            StartupTimer::mark("first paint");
+            watched->removeEventFilter(this);
+            deleteLater();
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+void StartupTimer::start()
+{
+    s_clock.start();
+    s_lastMarkNs = 0;
+}
+
+void StartupTimer::mark(const char *phase)
+{
+    if (!s_clock.isValid()) {
+        return;
+    }
+
+    qint64 now = s_clock.nsecsElapsed();
+    qCInfo(lcStartup, "%-24s %8.1f ms  (+%.1f ms)", phase,
+           now / 1e6, (now - s_lastMarkNs) / 1e6);
+    s_lastMarkNs = now;
+}
+
+void StartupTimer::markFirstPaint(QWidget *window)
+{
+    window->installEventFilter(new FirstPaintFilter(window));
+}
@@ -0,0 +1,22 @@
+#ifndef STARTUPTIMER_H
+#define STARTUPTIMER_H
+
+#include <QtGlobal>
+
+class QWidget;
+
+class StartupTimer
+{
+public:
+    // Starts the clock; call once, as early in main() as possible
+    static void start();
+
+    // Reports a startup phase with the time since start() and since the
+    // previous mark
+    static void mark(const char *phase);
+
+    // Marks "first paint" when the window delivers its first paint event
+    static void markFirstPaint(QWidget *window);
+};
+
+#endif // STARTUPTIMER_H
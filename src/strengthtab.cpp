@@ -0,0 +1,200 @@
+#include "strengthtab.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QSignalBlocker>
+#include "seriesupdater.h"
+#include "utils/trace.h"
+
+StrengthTab::StrengthTab(DataManager *dataManager, QWidget *parent)
+    : QWidget(parent)
+    , m_dataManager(dataManager)
+    , m_exerciseCombo(nullptr)
+    , m_formulaCombo(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_chartView(nullptr)
+    , m_chart(nullptr)
+    , m_oneRepMaxSeries(nullptr)
+    , m_volumeSeries(nullptr)
+    , m_dateAxis(nullptr)
+    , m_oneRepMaxAxis(nullptr)
+    , m_volumeAxis(nullptr)
+{
+    setupUI();
+}
+
+void StrengthTab::setupUI()
+{
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+
+    // Controls layout
+    QHBoxLayout *controlsLayout = new QHBoxLayout();
+
+    QLabel *exerciseLabel = new QLabel("Exercise:");
+    m_exerciseCombo = new QComboBox();
+    m_exerciseCombo->setMinimumWidth(200);
+
+    QLabel *formulaLabel = new QLabel("1RM Formula:");
+    m_formulaCombo = new QComboBox();
+    m_formulaCombo->addItem(Calculations::oneRepMaxFormulaName(Calculations::Epley), Calculations::Epley);
+    m_formulaCombo->addItem(Calculations::oneRepMaxFormulaName(Calculations::Brzycki), Calculations::Brzycki);
+
+    m_summaryLabel = new QLabel();
+    m_summaryLabel->setStyleSheet("QLabel { color: #666; }");
+
+    controlsLayout->addWidget(exerciseLabel);
+    controlsLayout->addWidget(m_exerciseCombo);
+    controlsLayout->addWidget(formulaLabel);
+    controlsLayout->addWidget(m_formulaCombo);
+    controlsLayout->addSpacing(16);
+    controlsLayout->addWidget(m_summaryLabel);
+    controlsLayout->addStretch();
+
+    // Chart with e1RM on the left axis and volume on the right
+    m_chart = new QChart();
+    m_chart->setTitle("Strength Progress");
+    m_chart->setAnimationOptions(QChart::SeriesAnimations);
+    m_chart->legend()->setVisible(true);
+    m_chart->legend()->setAlignment(Qt::AlignBottom);
+
+    m_oneRepMaxSeries = new QLineSeries();
+    m_oneRepMaxSeries->setName("Estimated 1RM");
+    m_oneRepMaxSeries->setPointsVisible(true);
+    m_volumeSeries = new QLineSeries();
+    m_volumeSeries->setName("Volume");
+    m_volumeSeries->setPen(QPen(QColor(40, 167, 69), 2, Qt::DashLine));
+
+    m_chart->addSeries(m_oneRepMaxSeries);
+    m_chart->addSeries(m_volumeSeries);
+
+    m_dateAxis = new QDateTimeAxis();
+    m_dateAxis->setTickCount(10);
+    m_dateAxis->setFormat("MMM dd");
+    m_dateAxis->setTitleText("Date");
+    m_chart->addAxis(m_dateAxis, Qt::AlignBottom);
+
+    m_oneRepMaxAxis = new QValueAxis();
+    m_oneRepMaxAxis->setTitleText("Estimated 1RM (kg)");
+    m_chart->addAxis(m_oneRepMaxAxis, Qt::AlignLeft);
+
+    m_volumeAxis = new QValueAxis();
+    m_volumeAxis->setTitleText("Volume (kg)");
+    m_chart->addAxis(m_volumeAxis, Qt::AlignRight);
+
+    m_oneRepMaxSeries->attachAxis(m_dateAxis);
+    m_oneRepMaxSeries->attachAxis(m_oneRepMaxAxis);
+    m_volumeSeries->attachAxis(m_dateAxis);
+    m_volumeSeries->attachAxis(m_volumeAxis);
+
+    m_chartView = new QChartView(m_chart);
+    m_chartView->setRenderHint(QPainter::Antialiasing);
+
+    mainLayout->addLayout(controlsLayout);
+    mainLayout->addWidget(m_chartView);
+
+    // Connect signals
+    connect(m_exerciseCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &StrengthTab::onExerciseChanged);
+    connect(m_formulaCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &StrengthTab::onExerciseChanged);
+}
+
+void StrengthTab::setDateRange(const QDate &startDate, const QDate &endDate)
+{
+    m_startDate = startDate;
+    m_endDate = endDate;
+}
+
+void StrengthTab::refresh()
+{
+    TRACE_SCOPE("StrengthTab::refresh");
+    populateExerciseCombo();
+    updateChart();
+}
+
+void StrengthTab::onExerciseChanged()
+{
+    updateChart();
+}
+
+void StrengthTab::populateExerciseCombo()
+{
+    int currentId = m_exerciseCombo->currentData().toInt();
+
+    QSignalBlocker blocker(m_exerciseCombo);
+    m_exerciseCombo->clear();
+    for (int exerciseId : m_dataManager->getTrainedExerciseIds()) {
+        m_exerciseCombo->addItem(m_dataManager->getTrainedExerciseName(exerciseId), exerciseId);
+    }
+
+    // Keep the selection across data changes when the exercise still exists
+    int index = m_exerciseCombo->findData(currentId);
+    m_exerciseCombo->setCurrentIndex(index >= 0 ? index : 0);
+}
+
+void StrengthTab::updateChart()
+{
+    QList<StrengthIndex::DayPoint> series;
+    if (m_exerciseCombo->currentIndex() >= 0) {
+        series = m_dataManager->getStrengthSeries(m_exerciseCombo->currentData().toInt(),
+                                                  m_startDate, m_endDate);
+    }
+
+    Calculations::OneRepMaxFormula formula =
+        static_cast<Calculations::OneRepMaxFormula>(m_formulaCombo->currentData().toInt());
+
+    QList<QPointF> oneRepMaxPoints;
+    QList<QPointF> volumePoints;
+    oneRepMaxPoints.reserve(series.size());
+    volumePoints.reserve(series.size());
+
+    double maxOneRepMax = 0.0;
+    double minOneRepMax = 0.0;
+    double maxVolume = 0.0;
+    for (const StrengthIndex::DayPoint &point : series) {
+        qint64 timestamp = point.date.startOfDay().toMSecsSinceEpoch();
+        double oneRepMax = point.oneRepMax(formula);
+        oneRepMaxPoints.append(QPointF(timestamp, oneRepMax));
+        volumePoints.append(QPointF(timestamp, point.volume));
+
+        minOneRepMax = oneRepMaxPoints.size() == 1 ? oneRepMax : qMin(minOneRepMax, oneRepMax);
+        maxOneRepMax = qMax(maxOneRepMax, oneRepMax);
+        maxVolume = qMax(maxVolume, point.volume);
+    }
+
+    SeriesUpdater::apply(m_oneRepMaxSeries, oneRepMaxPoints);
+    SeriesUpdater::apply(m_volumeSeries, volumePoints);
+
+    if (series.isEmpty()) {
+        m_summaryLabel->setText(m_exerciseCombo->count() == 0 ? "No workouts logged yet"
+                                                               : "No sessions in this period");
+        QDate endDate = m_endDate.isValid() ? m_endDate : QDate::currentDate();
+        QDate startDate = m_startDate.isValid() ? m_startDate : endDate.addDays(-365);
+        m_dateAxis->setRange(startDate.startOfDay(), endDate.startOfDay());
+        m_oneRepMaxAxis->setRange(0, 100);
+        m_volumeAxis->setRange(0, 1000);
+        return;
+    }
+
+    // Date axis follows the filter, or the data itself for "All Time"
+    QDate startDate = m_startDate.isValid() ? m_startDate : series.first().date;
+    QDate endDate = m_endDate.isValid() ? m_endDate : series.last().date;
+    if (startDate == endDate) {
+        startDate = startDate.addDays(-1);
+        endDate = endDate.addDays(1);
+    }
+    m_dateAxis->setRange(startDate.startOfDay(), endDate.startOfDay());
+
+    double padding = qMax(2.5, (maxOneRepMax - minOneRepMax) * 0.1);
+    m_oneRepMaxAxis->setRange(qMax(0.0, minOneRepMax - padding), maxOneRepMax + padding);
+    m_volumeAxis->setRange(0, maxVolume > 0 ? maxVolume * 1.1 : 1000);
+
+    double first = series.first().oneRepMax(formula);
+    double last = series.last().oneRepMax(formula);
+    // Points combine every session of a day, so the span is counted in days
+    m_summaryLabel->setText(QString("Best e1RM: %1 kg  |  Change: %2%3 kg over %4 training %5")
+                                .arg(maxOneRepMax, 0, 'f', 1)
+                                .arg(last >= first ? "+" : "")
+                                .arg(last - first, 0, 'f', 1)
+                                .arg(series.size())
+                                .arg(series.size() == 1 ? "day" : "days"));
+}
@@ -0,0 +1,58 @@
+#ifndef STRENGTHTAB_H
+#define STRENGTHTAB_H
+
+#include <QWidget>
+#include <QDate>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QChart>
+#include <QtCharts/QDateTimeAxis>
+#include <QtCharts/QValueAxis>
+#include <QLabel>
+#include <QComboBox>
+#include "models/datamanager.h"
+
+// Per-exercise strength progress: estimated one-rep max and session volume
+// over time. Data comes from DataManager's strength index, so switching
+// exercise or range never rescans the workout history.
+class StrengthTab : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit StrengthTab(DataManager *dataManager, QWidget *parent = nullptr);
+
+    // Invalid dates leave that side of the range open ("All Time")
+    void setDateRange(const QDate &startDate, const QDate &endDate);
+
+public slots:
+    void refresh();
+
+private slots:
+    void onExerciseChanged();
+
+private:
+    void setupUI();
+    void populateExerciseCombo();
+    void updateChart();
+
+    DataManager *m_dataManager;
+    QDate m_startDate;
+    QDate m_endDate;
+
+    // UI Components
+    QComboBox *m_exerciseCombo;
+    QComboBox *m_formulaCombo;
+    QLabel *m_summaryLabel;
+
+    // Chart
+    QChartView *m_chartView;
+    QChart *m_chart;
+    QLineSeries *m_oneRepMaxSeries;
+    QLineSeries *m_volumeSeries;
+    QDateTimeAxis *m_dateAxis;
+    QValueAxis *m_oneRepMaxAxis;
+    QValueAxis *m_volumeAxis;
+};
+
+#endif // STRENGTHTAB_H
@@ -0,0 +1,206 @@
+#include "trainingloadtab.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include "seriesupdater.h"
+#include "utils/trace.h"
+
+TrainingLoadTab::TrainingLoadTab(DataManager *dataManager, QWidget *parent)
+    : QWidget(parent)
+    , m_dataManager(dataManager)
+    , m_summaryLabel(nullptr)
+    , m_refitButton(nullptr)
+    , m_chartView(nullptr)
+    , m_chart(nullptr)
+    , m_fitnessSeries(nullptr)
+    , m_fatigueSeries(nullptr)
+    , m_performanceSeries(nullptr)
+    , m_ratioSeries(nullptr)
+    , m_sweetSpotArea(nullptr)
+    , m_dateAxis(nullptr)
+    , m_loadAxis(nullptr)
+    , m_performanceAxis(nullptr)
+    , m_ratioAxis(nullptr)
+{
+    setupUI();
+}
+
+void TrainingLoadTab::setupUI()
+{
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+
+    m_summaryLabel = new QLabel();
+    m_summaryLabel->setStyleSheet("QLabel { color: #666; }");
+
+    // The model fit is a grid search over the whole history, so edits
+    // reuse the last fit until asked to refit
+    m_refitButton = new QPushButton("Refit Model");
+    m_refitButton->setEnabled(false);
+    connect(m_refitButton, &QPushButton::clicked, this, &TrainingLoadTab::onRefitClicked);
+
+    m_chart = new QChart();
+    m_chart->setTitle("Training Load");
+    m_chart->setAnimationOptions(QChart::NoAnimation);
+    m_chart->legend()->setVisible(true);
+    m_chart->legend()->setAlignment(Qt::AlignBottom);
+
+    m_fitnessSeries = new QLineSeries();
+    m_fitnessSeries->setName("Fitness");
+    m_fitnessSeries->setPen(QPen(QColor(0, 123, 255), 2));
+    m_fatigueSeries = new QLineSeries();
+    m_fatigueSeries->setName("Fatigue");
+    m_fatigueSeries->setPen(QPen(QColor(220, 53, 69), 2));
+    m_performanceSeries = new QLineSeries();
+    m_performanceSeries->setName("Performance (model)");
+    m_performanceSeries->setPen(QPen(QColor(40, 167, 69), 2));
+    m_ratioSeries = new QLineSeries();
+    m_ratioSeries->setName("Acute:Chronic");
+    m_ratioSeries->setPen(QPen(QColor(108, 117, 125), 1, Qt::DashLine));
+
+    // Commonly cited safe range for the workload ratio
+    QLineSeries *sweetSpotUpper = new QLineSeries();
+    QLineSeries *sweetSpotLower = new QLineSeries();
+    m_sweetSpotArea = new QAreaSeries(sweetSpotUpper, sweetSpotLower);
+    m_sweetSpotArea->setName("ACWR 0.8-1.3");
+    m_sweetSpotArea->setBrush(QBrush(QColor(144, 238, 144, 60)));
+    m_sweetSpotArea->setPen(Qt::NoPen);
+
+    m_chart->addSeries(m_sweetSpotArea);
+    m_chart->addSeries(m_fitnessSeries);
+    m_chart->addSeries(m_fatigueSeries);
+    m_chart->addSeries(m_performanceSeries);
+    m_chart->addSeries(m_ratioSeries);
+
+    m_dateAxis = new QDateTimeAxis();
+    m_dateAxis->setTickCount(10);
+    m_dateAxis->setFormat("MMM dd");
+    m_dateAxis->setTitleText("Date");
+    m_chart->addAxis(m_dateAxis, Qt::AlignBottom);
+
+    m_loadAxis = new QValueAxis();
+    m_loadAxis->setTitleText("Load (t)");
+    m_chart->addAxis(m_loadAxis, Qt::AlignLeft);
+
+    m_performanceAxis = new QValueAxis();
+    m_performanceAxis->setTitleText("Performance (% of best e1RM)");
+    m_chart->addAxis(m_performanceAxis, Qt::AlignRight);
+
+    m_ratioAxis = new QValueAxis();
+    m_ratioAxis->setTitleText("Acute:Chronic");
+    m_ratioAxis->setRange(0, 2.5);
+    m_chart->addAxis(m_ratioAxis, Qt::AlignRight);
+
+    m_sweetSpotArea->attachAxis(m_dateAxis);
+    m_sweetSpotArea->attachAxis(m_ratioAxis);
+    m_fitnessSeries->attachAxis(m_dateAxis);
+    m_fitnessSeries->attachAxis(m_loadAxis);
+    m_fatigueSeries->attachAxis(m_dateAxis);
+    m_fatigueSeries->attachAxis(m_loadAxis);
+    m_performanceSeries->attachAxis(m_dateAxis);
+    m_performanceSeries->attachAxis(m_performanceAxis);
+    m_ratioSeries->attachAxis(m_dateAxis);
+    m_ratioSeries->attachAxis(m_ratioAxis);
+
+    m_chartView = new QChartView(m_chart);
+    m_chartView->setRenderHint(QPainter::Antialiasing);
+
+    QHBoxLayout *summaryLayout = new QHBoxLayout();
+    summaryLayout->addWidget(m_summaryLabel, 1);
+    summaryLayout->addWidget(m_refitButton);
+
+    mainLayout->addLayout(summaryLayout);
+    mainLayout->addWidget(m_chartView);
+}
+
+void TrainingLoadTab::setDateRange(const QDate &startDate, const QDate &endDate)
+{
+    m_startDate = startDate;
+    m_endDate = endDate;
+}
+
+void TrainingLoadTab::refresh()
+{
+    TRACE_SCOPE("TrainingLoadTab::refresh");
+    QList<TrainingLoad::Day> days = m_dataManager->getTrainingLoad(m_startDate, m_endDate);
+    TrainingLoad::Parameters parameters = m_dataManager->getTrainingLoadParameters();
+
+    QList<QPointF> fitnessPoints;
+    QList<QPointF> fatiguePoints;
+    QList<QPointF> performancePoints;
+    QList<QPointF> ratioPoints;
+    fitnessPoints.reserve(days.size());
+    fatiguePoints.reserve(days.size());
+    performancePoints.reserve(days.size());
+    ratioPoints.reserve(days.size());
+
+    double maxLoad = 0.0;
+    double minPerformance = 0.0;
+    double maxPerformance = 0.0;
+    for (int i = 0; i < days.size(); ++i) {
+        const TrainingLoad::Day &day = days[i];
+        qint64 timestamp = day.date.startOfDay().toMSecsSinceEpoch();
+        fitnessPoints.append(QPointF(timestamp, day.fitness));
+        fatiguePoints.append(QPointF(timestamp, day.fatigue));
+        ratioPoints.append(QPointF(timestamp, day.ratio));
+        maxLoad = qMax(maxLoad, qMax(day.fitness, day.fatigue));
+
+        if (parameters.fitted) {
+            performancePoints.append(QPointF(timestamp, day.performance));
+            minPerformance = i == 0 ? day.performance : qMin(minPerformance, day.performance);
+            maxPerformance = i == 0 ? day.performance : qMax(maxPerformance, day.performance);
+        }
+    }
+
+    SeriesUpdater::apply(m_fitnessSeries, fitnessPoints);
+    SeriesUpdater::apply(m_fatigueSeries, fatiguePoints);
+    SeriesUpdater::apply(m_performanceSeries, performancePoints);
+    SeriesUpdater::apply(m_ratioSeries, ratioPoints);
+
+    QDate endDate = m_endDate.isValid() ? m_endDate : (days.isEmpty() ? QDate::currentDate() : days.last().date);
+    QDate startDate = m_startDate.isValid() ? m_startDate : (days.isEmpty() ? endDate.addDays(-365) : days.first().date);
+    if (startDate >= endDate) {
+        startDate = endDate.addDays(-1);
+    }
+    m_dateAxis->setRange(startDate.startOfDay(), endDate.startOfDay());
+
+    qint64 startTime = startDate.startOfDay().toMSecsSinceEpoch();
+    qint64 endTime = endDate.startOfDay().toMSecsSinceEpoch();
+    m_sweetSpotArea->upperSeries()->replace({QPointF(startTime, 1.3), QPointF(endTime, 1.3)});
+    m_sweetSpotArea->lowerSeries()->replace({QPointF(startTime, 0.8), QPointF(endTime, 0.8)});
+
+    m_loadAxis->setRange(0, maxLoad > 0 ? maxLoad * 1.1 : 10);
+    double padding = qMax(1.0, (maxPerformance - minPerformance) * 0.1);
+    m_performanceAxis->setRange(minPerformance - padding, maxPerformance + padding);
+    m_performanceAxis->setVisible(parameters.fitted);
+    m_refitButton->setEnabled(parameters.stale);
+
+    if (days.isEmpty()) {
+        m_summaryLabel->setText("No workouts logged yet");
+        return;
+    }
+
+    const TrainingLoad::Day &today = days.last();
+    QString text = QString("Acute:chronic %1 (7-day %2 t/day, 28-day %3 t/day)")
+                       .arg(today.ratio, 0, 'f', 2)
+                       .arg(today.acute, 0, 'f', 2)
+                       .arg(today.chronic, 0, 'f', 2);
+    if (parameters.fitted) {
+        text += QString("  |  Model: τ fitness %1 d, τ fatigue %2 d, k1 %3, k2 %4 (%5 observations)")
+                    .arg(parameters.fitnessDecay)
+                    .arg(parameters.fatigueDecay)
+                    .arg(parameters.k1, 0, 'g', 3)
+                    .arg(parameters.k2, 0, 'g', 3)
+                    .arg(parameters.observations);
+        if (parameters.stale) {
+            text += ", fitted before the latest changes";
+        }
+    } else {
+        text += QString("  |  Model needs more strength sessions to fit (%1 so far)").arg(parameters.observations);
+    }
+    m_summaryLabel->setText(text);
+}
+
+void TrainingLoadTab::onRefitClicked()
+{
+    m_dataManager->refitTrainingLoad();
+    refresh();
+}
@@ -0,0 +1,58 @@
+#ifndef TRAININGLOADTAB_H
+#define TRAININGLOADTAB_H
+
+#include <QWidget>
+#include <QDate>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QAreaSeries>
+#include <QtCharts/QChart>
+#include <QtCharts/QDateTimeAxis>
+#include <QtCharts/QValueAxis>
+#include <QLabel>
+#include <QPushButton>
+#include "models/datamanager.h"
+
+// Fitness, fatigue and modelled performance (Banister) together with the
+// acute:chronic workload ratio, from DataManager's training load engine.
+class TrainingLoadTab : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit TrainingLoadTab(DataManager *dataManager, QWidget *parent = nullptr);
+
+    // Invalid dates leave that side of the range open ("All Time")
+    void setDateRange(const QDate &startDate, const QDate &endDate);
+
+public slots:
+    void refresh();
+
+private slots:
+    void onRefitClicked();
+
+private:
+    void setupUI();
+
+    DataManager *m_dataManager;
+    QDate m_startDate;
+    QDate m_endDate;
+
+    QLabel *m_summaryLabel;
+    QPushButton *m_refitButton;    // enabled once edits have made the fit stale
+
+    // Chart
+    QChartView *m_chartView;
+    QChart *m_chart;
+    QLineSeries *m_fitnessSeries;
+    QLineSeries *m_fatigueSeries;
+    QLineSeries *m_performanceSeries;
+    QLineSeries *m_ratioSeries;
+    QAreaSeries *m_sweetSpotArea;    // ACWR 0.8-1.3
+    QDateTimeAxis *m_dateAxis;
+    QValueAxis *m_loadAxis;
+    QValueAxis *m_performanceAxis;
+    QValueAxis *m_ratioAxis;
+};
+
+#endif // TRAININGLOADTAB_H
@@ -0,0 +1,141 @@
+#include "allocationcounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Zero-initialized before any dynamic initializer can allocate
+std::atomic<qint64> s_allocations{0};
+std::atomic<qint64> s_bytes{0};
+std::atomic<qint64> s_deallocations{0};
+
+} // namespace
+
+#ifdef FITNESS_ALLOCATION_COUNTING
+
+namespace {
+
+void *countedAllocate(std::size_t size)
+{
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_bytes.fetch_add(qint64(size), std::memory_order_relaxed);
+
+    if (size == 0) {
+        size = 1;
+    }
+    for (;;) {
+        if (void *pointer = std::malloc(size)) {
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void countedFree(void *pointer) noexcept
+{
+    if (pointer) {
+        s_deallocations.fetch_add(1, std::memory_order_relaxed);
+        std::free(pointer);
+    }
+}
+
+} // namespace
+
+// Over-aligned new/delete keep the library's own pairing and go uncounted
+void *operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try {
+        return countedAllocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    try {
+        return countedAllocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void *pointer) noexcept
+{
+    countedFree(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    countedFree(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    countedFree(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    countedFree(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept
+{
+    countedFree(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept
+{
+    countedFree(pointer);
+}
+
+#endif // FITNESS_ALLOCATION_COUNTING
+
+bool AllocationCounter::isAvailable()
+{
+#ifdef FITNESS_ALLOCATION_COUNTING
+    return true;
+#else
+    return false;
+#endif
+}
+
+AllocationCounter::Counts AllocationCounter::current()
+{
+    Counts counts;
+    counts.allocations = s_allocations.load(std::memory_order_relaxed);
+    counts.bytes = s_bytes.load(std::memory_order_relaxed);
+    counts.deallocations = s_deallocations.load(std::memory_order_relaxed);
+    return counts;
+}
+
+AllocationScope::AllocationScope()
+    : m_start(AllocationCounter::current())
+{
+}
+
+AllocationCounter::Counts AllocationScope::counts() const
+{
+    AllocationCounter::Counts now = AllocationCounter::current();
+    AllocationCounter::Counts counts;
+    counts.allocations = now.allocations - m_start.allocations;
+    counts.bytes = now.bytes - m_start.bytes;
+    counts.deallocations = now.deallocations - m_start.deallocations;
+    return counts;
+}
@@ -0,0 +1,42 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+// Process-wide heap allocation counts, fed by replacement operator
+// new/delete. The hooks are compiled in only when FITNESS_ALLOCATION_COUNTING
+// is defined (Debug builds, builds with the benchmarks, or
+// -DFITNESS_ALLOCATION_COUNTING=ON); otherwise isAvailable() is false and
+// every count reads zero. Counting is a relaxed atomic add per call, so
+// counts from other threads land in whichever scope is open.
+class AllocationCounter
+{
+public:
+    struct Counts {
+        qint64 allocations = 0;
+        qint64 bytes = 0;        // requested, not including allocator overhead
+        qint64 deallocations = 0;
+    };
+
+    static bool isAvailable();
+
+    // Totals since process start
+    static Counts current();
+};
+
+// Counts the allocations made while the scope is alive
+class AllocationScope
+{
+public:
+    AllocationScope();
+
+    AllocationCounter::Counts counts() const;
+
+    AllocationScope(const AllocationScope &) = delete;
+    AllocationScope &operator=(const AllocationScope &) = delete;
+
+private:
+    AllocationCounter::Counts m_start;
+};
+
+#endif // ALLOCATIONCOUNTER_H
@@ -72,4 +72,36 @@ QString Calculations::getBMICategoryColor(const QString &category)
     } else {
         return "#333"; // Default dark gray
     }
-} 
\ No newline at end of file
+}
+
+double Calculations::epleyOneRepMax(double weight, int reps)
+{
+    if (weight <= 0.0 || reps <= 0) {
+        return 0.0;
+    }
+    if (reps == 1) {
+        return weight;
+    }
+    // Epley: weight × (1 + reps / 30)
+    return weight * (1.0 + reps / 30.0);
+}
+
+double Calculations::brzyckiOneRepMax(double weight, int reps)
+{
+    if (weight <= 0.0 || reps <= 0) {
+        return 0.0;
+    }
+    // Brzycki: weight × 36 / (37 - reps), undefined from 37 reps on
+    int clampedReps = reps < 36 ? reps : 36;
+    return weight * 36.0 / (37.0 - clampedReps);
+}
+
+double Calculations::oneRepMax(double weight, int reps, OneRepMaxFormula formula)
+{
+    return formula == Brzycki ? brzyckiOneRepMax(weight, reps) : epleyOneRepMax(weight, reps);
+}
+
+QString Calculations::oneRepMaxFormulaName(OneRepMaxFormula formula)
+{
+    return formula == Brzycki ? "Brzycki" : "Epley";
+}
@@ -15,6 +15,16 @@ public:
     static QString getBodyFatCategory(double bodyFat, bool isMale = true);
     static QString formatBodyFat(double bodyFat, bool isMale = true);
     static QString getBodyFatCategoryColor(const QString &category);
+    
+    // Estimated one-rep max
+    enum OneRepMaxFormula {
+        Epley,
+        Brzycki
+    };
+    static double epleyOneRepMax(double weight, int reps);
+    static double brzyckiOneRepMax(double weight, int reps);
+    static double oneRepMax(double weight, int reps, OneRepMaxFormula formula);
+    static QString oneRepMaxFormulaName(OneRepMaxFormula formula);
 };
 
 #endif // CALCULATIONS_H 
\ No newline at end of file
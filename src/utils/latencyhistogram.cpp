@@ -0,0 +1,131 @@
+#include "latencyhistogram.h"
+#include "trace.h"
+#include <QtAlgorithms>
+
+LatencyHistogram::LatencyHistogram()
+    : m_count(0)
+    , m_totalNs(0)
+    , m_maxNs(0)
+{
+    for (std::atomic<quint64> &bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+int LatencyHistogram::bucketFor(qint64 ns)
+{
+    if (ns < LinearBuckets) {
+        return ns < 0 ? 0 : int(ns);
+    }
+
+    quint64 value = quint64(ns);
+    int msb = 63 - qCountLeadingZeroBits(value);
+    int shift = msb - 4;  // leaves value >> shift in [16, 32)
+    if (shift > MaxShift) {
+        return BucketCount - 1;
+    }
+    return LinearBuckets + (shift - 1) * SubBuckets + int(value >> shift) - SubBuckets;
+}
+
+qint64 LatencyHistogram::bucketUpperEdge(int bucket)
+{
+    if (bucket < LinearBuckets) {
+        return bucket;
+    }
+
+    int offset = bucket - LinearBuckets;
+    int shift = offset / SubBuckets + 1;
+    qint64 sub = offset % SubBuckets + SubBuckets;
+    return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(qint64 ns)
+{
+    m_buckets[bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_totalNs.fetch_add(quint64(qMax<qint64>(0, ns)), std::memory_order_relaxed);
+
+    qint64 max = m_maxNs.load(std::memory_order_relaxed);
+    while (ns > max && !m_maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (std::atomic<quint64> &bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_totalNs.store(0, std::memory_order_relaxed);
+    m_maxNs.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Summary LatencyHistogram::summary() const
+{
+    // Work from one snapshot of the buckets so concurrent records can't
+    // push a percentile past the total
+    quint64 counts[BucketCount];
+    quint64 total = 0;
+    for (int i = 0; i < BucketCount; ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    Summary result;
+    result.count = total;
+    if (total == 0) {
+        return result;
+    }
+    result.max = m_maxNs.load(std::memory_order_relaxed);
+    result.mean = double(m_totalNs.load(std::memory_order_relaxed)) / double(m_count.load(std::memory_order_relaxed));
+
+    const double quantiles[] = {0.50, 0.90, 0.99};
+    qint64 *targets[] = {&result.p50, &result.p90, &result.p99};
+    int next = 0;
+    quint64 seen = 0;
+    for (int i = 0; i < BucketCount && next < 3; ++i) {
+        seen += counts[i];
+        while (next < 3 && seen >= quint64(quantiles[next] * total + 0.5) && seen > 0) {
+            *targets[next] = qMin(bucketUpperEdge(i), result.max);
+            ++next;
+        }
+    }
+
+    return result;
+}
+
+LatencyHistogram &Latency::histogram(Metric metric)
+{
+    static LatencyHistogram histograms[MetricCount];
+    return histograms[metric];
+}
+
+const char *Latency::name(Metric metric)
+{
+    switch (metric) {
+    case Load: return "Load data";
+    case Save: return "Save data";
+    case ChartRefresh: return "Chart refresh";
+    case Navigation: return "Date navigation";
+    case MetricCount: break;
+    }
+    return "";
+}
+
+void Latency::resetAll()
+{
+    for (int i = 0; i < MetricCount; ++i) {
+        histogram(Metric(i)).reset();
+    }
+}
+
+LatencyScope::LatencyScope(Latency::Metric metric)
+    : m_metric(metric)
+    , m_startNs(Trace::nowNs())
+{
+}
+
+LatencyScope::~LatencyScope()
+{
+    Latency::histogram(m_metric).record(Trace::nowNs() - m_startNs);
+}
@@ -0,0 +1,79 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QtGlobal>
+#include <atomic>
+
+// HDR-style histogram of durations in nanoseconds: exact below 32 ns, then
+// 16 sub-buckets per power of two (about 6% relative precision) up to 2^45 ns,
+// about 9.8 hours; longer durations count in the last bucket. Recording is a
+// few relaxed atomic adds, so it can run from any thread and stays on in
+// Release builds.
+class LatencyHistogram
+{
+public:
+    struct Summary {
+        quint64 count = 0;
+        qint64 p50 = 0;
+        qint64 p90 = 0;
+        qint64 p99 = 0;
+        qint64 max = 0;
+        double mean = 0.0;
+    };
+
+    LatencyHistogram();
+
+    void record(qint64 ns);
+    void reset();
+
+    // Percentiles report the upper edge of the bucket they fall in
+    Summary summary() const;
+
+private:
+    static constexpr int SubBuckets = 16;
+    static constexpr int LinearBuckets = 32;
+    static constexpr int MaxShift = 40;
+    static constexpr int BucketCount = LinearBuckets + MaxShift * SubBuckets;
+
+    static int bucketFor(qint64 ns);
+    static qint64 bucketUpperEdge(int bucket);
+
+    std::atomic<quint64> m_buckets[BucketCount];
+    std::atomic<quint64> m_count;
+    std::atomic<quint64> m_totalNs;
+    std::atomic<qint64> m_maxNs;
+};
+
+// The operations shown in the diagnostics window
+class Latency
+{
+public:
+    enum Metric {
+        Load,
+        Save,
+        ChartRefresh,
+        Navigation,
+        MetricCount
+    };
+
+    static LatencyHistogram &histogram(Metric metric);
+    static const char *name(Metric metric);
+    static void resetAll();
+};
+
+// Records the lifetime of the scope into one of the Latency histograms
+class LatencyScope
+{
+public:
+    explicit LatencyScope(Latency::Metric metric);
+    ~LatencyScope();
+
+    LatencyScope(const LatencyScope &) = delete;
+    LatencyScope &operator=(const LatencyScope &) = delete;
+
+private:
+    Latency::Metric m_metric;
+    qint64 m_startNs;
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,31 @@
+#include "logging.h"
+
+Q_LOGGING_CATEGORY(lcData, "fitness.data", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcAnalytics, "fitness.analytics", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcUi, "fitness.ui", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcStartup, "fitness.startup", QtInfoMsg)
+
+namespace {
+bool s_verbose = false;
+}
+
+void Logging::setVerbose(bool verbose)
+{
+    s_verbose = verbose;
+    QLoggingCategory::setFilterRules(verbose ? QStringLiteral("fitness.*.debug=true")
+                                             : QStringLiteral("fitness.*.debug=false"));
+}
+
+bool Logging::isVerbose()
+{
+    return s_verbose;
+}
+
+bool Logging::debugOutputAvailable()
+{
+#ifdef QT_NO_DEBUG_OUTPUT
+    return false;
+#else
+    return true;
+#endif
+}
@@ -0,0 +1,26 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+
+#include <QLoggingCategory>
+
+// Debug output is off by default and compiled out of Release builds
+// (QT_NO_DEBUG_OUTPUT), so qCDebug() in hot paths costs nothing there.
+// Enable it at runtime with --verbose, the Help menu, or QT_LOGGING_RULES,
+// e.g. QT_LOGGING_RULES="fitness.analytics.debug=true".
+Q_DECLARE_LOGGING_CATEGORY(lcData)       // fitness.data
+Q_DECLARE_LOGGING_CATEGORY(lcAnalytics)  // fitness.analytics
+Q_DECLARE_LOGGING_CATEGORY(lcUi)         // fitness.ui
+Q_DECLARE_LOGGING_CATEGORY(lcStartup)    // fitness.startup
+
+class Logging
+{
+public:
+    // Turns debug output on or off for every fitness.* category
+    static void setVerbose(bool verbose);
+    static bool isVerbose();
+
+    // False when debug output was compiled out
+    static bool debugOutputAvailable();
+};
+
+#endif // LOGGING_H
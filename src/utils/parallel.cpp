@@ -0,0 +1,52 @@
+#include "parallel.h"
+#include "trace.h"
+#include <QThread>
+#include <thread>
+#include <vector>
+
+void Parallel::forChunks(qsizetype count,
+                         const std::function<void(qsizetype begin, qsizetype end)> &work,
+                         qsizetype minChunkSize)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    qsizetype chunks = count / qMax<qsizetype>(1, minChunkSize);
+    int threads = static_cast<int>(qBound<qsizetype>(1, chunks, threadCount()));
+    if (threads == 1) {
+        work(0, count);
+        return;
+    }
+
+    qsizetype chunkSize = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    for (int t = 1; t < threads; ++t) {
+        qsizetype begin = t * chunkSize;
+        qsizetype end = qMin(count, begin + chunkSize);
+        if (begin >= end) {
+            break;
+        }
+        workers.emplace_back([&work, begin, end]() {
+            TRACE_SCOPE("Parallel::chunk");
+            work(begin, end);
+        });
+    }
+
+    // The calling thread takes the first chunk
+    {
+        TRACE_SCOPE("Parallel::chunk");
+        work(0, qMin(count, chunkSize));
+    }
+
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+int Parallel::threadCount()
+{
+    return qMax(1, QThread::idealThreadCount());
+}
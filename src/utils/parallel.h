@@ -0,0 +1,25 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <QtGlobal>
+#include <functional>
+
+class Parallel
+{
+public:
+    // Splits [0, count) into contiguous chunks and runs them on worker threads,
+    // blocking until every chunk is done. Inputs smaller than two chunks run on
+    // the calling thread.
+    //
+    // Callers size their output lists and take raw data pointers before the
+    // call; work must only go through those pointers. Non-const QList access
+    // can detach and copying a list touches its shared reference count, and
+    // neither is safe from several threads at once.
+    static void forChunks(qsizetype count,
+                          const std::function<void(qsizetype begin, qsizetype end)> &work,
+                          qsizetype minChunkSize = 4096);
+
+    static int threadCount();
+};
+
+#endif // PARALLEL_H
@@ -0,0 +1,38 @@
+#ifndef POSTINGS_H
+#define POSTINGS_H
+
+#include <QList>
+#include <QtGlobal>
+
+// Shared upkeep for the slot-based search indexes (exercise trigrams, note
+// words). Entries live in slots of a flat list; removing one frees its slot
+// for the next addition, so slot numbers stay small and the per-slot query
+// counters stay dense. Posting lists map a key to the slots containing it.
+class Postings
+{
+public:
+    // Drops a slot from the posting list of each of its keys, erasing lists
+    // that become empty. Posting order doesn't matter, so removal is a
+    // swap with the last entry. Works with QMap and QHash postings.
+    template <typename Map, typename Keys>
+    static void removeSlot(Map &postings, const Keys &keys, int slot)
+    {
+        for (const auto &key : keys) {
+            auto posting = postings.find(key);
+            if (posting == postings.end()) {
+                continue;
+            }
+            QList<int> &slots = posting.value();
+            qsizetype position = slots.indexOf(slot);
+            if (position >= 0) {
+                slots[position] = slots.last();
+                slots.removeLast();
+            }
+            if (slots.isEmpty()) {
+                postings.erase(posting);
+            }
+        }
+    }
+};
+
+#endif // POSTINGS_H
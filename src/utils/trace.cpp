@@ -0,0 +1,264 @@
+#include "trace.h"
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <vector>
+
+std::atomic<int> Trace::s_flags(0);
+
+namespace {
+
+constexpr quint64 RingSize = 8192;  // events per thread, power of two
+
+struct Event {
+    const char *name;
+    qint64 startNs;
+    qint64 endNs;
+    int threadId;
+};
+
+// The exporter may read a slot while its owner overwrites it, so the
+// fields are relaxed atomics; torn copies are found and dropped by
+// re-reading head afterwards
+struct Slot {
+    std::atomic<const char *> name{nullptr};
+    std::atomic<qint64> startNs{0};
+    std::atomic<qint64> endNs{0};
+    std::atomic<int> threadId{0};
+};
+
+// Written only by its owning thread; head is published with release so
+// the exporter can copy a consistent window without locking the writer.
+// clear() only moves clearedAt, which the owner never touches.
+struct Ring {
+    Slot events[RingSize];
+    std::atomic<quint64> head{0};
+    std::atomic<quint64> clearedAt{0};
+};
+
+constexpr int MaxSpanDepth = 32;
+
+struct ThreadState;
+
+// Rings outlive their threads so short-lived workers still show up in a
+// dump; a finished thread's ring is handed to the next new thread
+QMutex s_registryMutex;
+std::vector<Ring *> s_rings;
+std::vector<Ring *> s_freeRings;
+std::map<int, ThreadState *> s_threads;
+std::atomic<int> s_nextThreadId{1};
+int s_mainThreadId = 0;
+
+const auto s_epoch = std::chrono::steady_clock::now();
+
+struct ThreadState {
+    Ring *ring = nullptr;
+    int threadId = s_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+    // Open spans, innermost last; read by other threads under the registry
+    // mutex, which also keeps this state alive while it is read
+    std::atomic<const char *> spans[MaxSpanDepth] = {};
+    std::atomic<int> depth{0};
+
+    ThreadState()
+    {
+        QMutexLocker locker(&s_registryMutex);
+        s_threads[threadId] = this;
+    }
+
+    ~ThreadState()
+    {
+        QMutexLocker locker(&s_registryMutex);
+        s_threads.erase(threadId);
+        if (ring) {
+            s_freeRings.push_back(ring);
+        }
+    }
+
+    Ring *acquireRing()
+    {
+        if (!ring) {
+            QMutexLocker locker(&s_registryMutex);
+            if (!s_freeRings.empty()) {
+                ring = s_freeRings.back();
+                s_freeRings.pop_back();
+            } else {
+                ring = new Ring;
+                s_rings.push_back(ring);
+            }
+        }
+        return ring;
+    }
+};
+
+thread_local ThreadState t_state;
+
+QString jsonEscape(const char *text)
+{
+    QString escaped = QString::fromUtf8(text);
+    escaped.replace('\\', "\\\\");
+    escaped.replace('"', "\\\"");
+    return escaped;
+}
+
+} // namespace
+
+void Trace::setEnabled(bool enabled)
+{
+    if (enabled && s_mainThreadId == 0) {
+        // Tracing is switched on from the GUI thread (flag or menu)
+        s_mainThreadId = t_state.threadId;
+    }
+    setFlag(Recording, enabled);
+}
+
+void Trace::setSpanStackEnabled(bool enabled)
+{
+    setFlag(SpanStack, enabled);
+}
+
+void Trace::setFlag(Flag flag, bool on)
+{
+    if (on) {
+        s_flags.fetch_or(flag, std::memory_order_relaxed);
+    } else {
+        s_flags.fetch_and(~flag, std::memory_order_relaxed);
+    }
+}
+
+int Trace::currentThreadId()
+{
+    return t_state.threadId;
+}
+
+QStringList Trace::activeSpans(int threadId)
+{
+    QStringList result;
+    QMutexLocker locker(&s_registryMutex);
+    auto it = s_threads.find(threadId);
+    if (it == s_threads.end()) {
+        return result;
+    }
+
+    const ThreadState *state = it->second;
+    int depth = qMin(state->depth.load(std::memory_order_acquire), MaxSpanDepth);
+    for (int i = 0; i < depth; ++i) {
+        if (const char *name = state->spans[i].load(std::memory_order_relaxed)) {
+            result.append(QString::fromUtf8(name));
+        }
+    }
+    return result;
+}
+
+void Trace::clear()
+{
+    QMutexLocker locker(&s_registryMutex);
+    for (Ring *ring : s_rings) {
+        ring->clearedAt.store(ring->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+qint64 Trace::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+qint64 Trace::enter(const char *name, int flags)
+{
+    if (flags & SpanStack) {
+        int depth = t_state.depth.load(std::memory_order_relaxed);
+        if (depth < MaxSpanDepth) {
+            t_state.spans[depth].store(name, std::memory_order_relaxed);
+        }
+        t_state.depth.store(depth + 1, std::memory_order_release);
+    }
+    return (flags & Recording) ? nowNs() : 0;
+}
+
+void Trace::leave(const char *name, int flags, qint64 startNs)
+{
+    if (flags & Recording) {
+        qint64 endNs = nowNs();
+        Ring *ring = t_state.acquireRing();
+        quint64 head = ring->head.load(std::memory_order_relaxed);
+        Slot &slot = ring->events[head & (RingSize - 1)];
+
+        // An exporter that reads any of these stores also sees the head
+        // published before them, and so knows the slot is being rewritten
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.startNs.store(startNs, std::memory_order_relaxed);
+        slot.endNs.store(endNs, std::memory_order_relaxed);
+        slot.threadId.store(t_state.threadId, std::memory_order_relaxed);
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+    if (flags & SpanStack) {
+        t_state.depth.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool Trace::writeChromeJson(const QString &filePath)
+{
+    std::vector<Event> events;
+    {
+        QMutexLocker locker(&s_registryMutex);
+        for (Ring *ring : s_rings) {
+            quint64 head = ring->head.load(std::memory_order_acquire);
+            quint64 first = head > RingSize ? head - RingSize : 0;
+            first = qMax(first, qMin(head, ring->clearedAt.load(std::memory_order_relaxed)));
+            size_t copied = events.size();
+            for (quint64 i = first; i < head; ++i) {
+                const Slot &slot = ring->events[i & (RingSize - 1)];
+                events.push_back(Event{slot.name.load(std::memory_order_relaxed),
+                                       slot.startNs.load(std::memory_order_relaxed),
+                                       slot.endNs.load(std::memory_order_relaxed),
+                                       slot.threadId.load(std::memory_order_relaxed)});
+            }
+
+            // Anything the writer lapped while we copied may be torn,
+            // including the slot it may be filling right now
+            std::atomic_thread_fence(std::memory_order_acquire);
+            quint64 limit = ring->head.load(std::memory_order_relaxed) + 1;
+            if (limit > RingSize && limit - RingSize > first) {
+                quint64 overwritten = qMin(limit - RingSize - first, head - first);
+                events.erase(events.begin() + copied, events.begin() + copied + overwritten);
+            }
+        }
+    }
+
+    std::sort(events.begin(), events.end(), [](const Event &a, const Event &b) {
+        return a.startNs < b.startNs;
+    });
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    if (s_mainThreadId != 0) {
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << s_mainThreadId
+            << ",\"args\":{\"name\":\"GUI\"}}";
+        if (!events.empty()) {
+            out << ",\n";
+        }
+    }
+    for (size_t i = 0; i < events.size(); ++i) {
+        const Event &event = events[i];
+        out << "{\"name\":\"" << jsonEscape(event.name) << "\",\"ph\":\"X\",\"pid\":1"
+            << ",\"tid\":" << event.threadId
+            << ",\"ts\":" << QString::number(event.startNs / 1000.0, 'f', 3)
+            << ",\"dur\":" << QString::number((event.endNs - event.startNs) / 1000.0, 'f', 3) << "}";
+        out << (i + 1 < events.size() ? ",\n" : "\n");
+    }
+    out << "]}\n";
+    out.flush();
+
+    return out.status() == QTextStream::Ok;
+}
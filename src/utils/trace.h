@@ -0,0 +1,83 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+#include <atomic>
+
+// Scoped timing spans written to a per-thread ring buffer and exported as
+// Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev). A span costs
+// one relaxed atomic load while neither recording nor the span stack is on.
+//
+//     void DataManager::saveData()
+//     {
+//         TRACE_SCOPE("DataManager::saveData");
+//         ...
+//     }
+//
+// Span names must be string literals; only the pointer is stored.
+class Trace
+{
+public:
+    enum Flag {
+        Recording = 0x1,   // completed spans go to the ring buffers
+        SpanStack = 0x2    // open spans are visible through activeSpans()
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled() { return flags() & Recording; }
+
+    // Used by StallWatchdog to name what a blocked thread is doing
+    static void setSpanStackEnabled(bool enabled);
+    static QStringList activeSpans(int threadId);
+    static int currentThreadId();
+
+    // Drops every span recorded so far; safe while tracing is running
+    static void clear();
+
+    // Writes the spans currently held by all threads' buffers
+    static bool writeChromeJson(const QString &filePath);
+
+    static qint64 nowNs();
+    static int flags() { return s_flags.load(std::memory_order_relaxed); }
+    static qint64 enter(const char *name, int flags);
+    static void leave(const char *name, int flags, qint64 startNs);
+
+private:
+    static void setFlag(Flag flag, bool on);
+
+    static std::atomic<int> s_flags;
+};
+
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char *name)
+        : m_name(name)
+        , m_flags(Trace::flags())
+        , m_startNs(m_flags ? Trace::enter(name, m_flags) : 0)
+    {
+    }
+
+    ~TraceSpan()
+    {
+        if (m_flags) {
+            Trace::leave(m_name, m_flags, m_startNs);
+        }
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+    const char *m_name;
+    int m_flags;
+    qint64 m_startNs;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceSpan TRACE_CONCAT(traceSpan_, __LINE__)(name)
+
+#endif // TRACE_H
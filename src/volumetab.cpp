@@ -0,0 +1,183 @@
+#include "volumetab.h"
+#include "utils/trace.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QtCharts/QBarSet>
+#include <algorithm>
+
+VolumeTab::VolumeTab(DataManager *dataManager, QWidget *parent)
+    : QWidget(parent)
+    , m_dataManager(dataManager)
+    , m_periodCombo(nullptr)
+    , m_measureCombo(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_chartView(nullptr)
+    , m_chart(nullptr)
+    , m_series(nullptr)
+    , m_periodAxis(nullptr)
+    , m_valueAxis(nullptr)
+{
+    setupUI();
+}
+
+void VolumeTab::setupUI()
+{
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+
+    // Controls layout
+    QHBoxLayout *controlsLayout = new QHBoxLayout();
+
+    QLabel *periodLabel = new QLabel("Group by:");
+    m_periodCombo = new QComboBox();
+    m_periodCombo->addItem("Week", VolumeRollup::Week);
+    m_periodCombo->addItem("Month", VolumeRollup::Month);
+
+    QLabel *measureLabel = new QLabel("Show:");
+    m_measureCombo = new QComboBox();
+    m_measureCombo->addItem("Volume (kg)", Volume);
+    m_measureCombo->addItem("Sets", Sets);
+    m_measureCombo->addItem("Reps", Reps);
+
+    m_summaryLabel = new QLabel();
+    m_summaryLabel->setStyleSheet("QLabel { color: #666; }");
+
+    controlsLayout->addWidget(periodLabel);
+    controlsLayout->addWidget(m_periodCombo);
+    controlsLayout->addWidget(measureLabel);
+    controlsLayout->addWidget(m_measureCombo);
+    controlsLayout->addSpacing(16);
+    controlsLayout->addWidget(m_summaryLabel);
+    controlsLayout->addStretch();
+
+    m_chart = new QChart();
+    m_chart->setTitle("Training Volume by Category");
+    m_chart->setAnimationOptions(QChart::SeriesAnimations);
+    m_chart->legend()->setVisible(true);
+    m_chart->legend()->setAlignment(Qt::AlignBottom);
+
+    m_series = new QStackedBarSeries();
+    m_chart->addSeries(m_series);
+
+    m_periodAxis = new QBarCategoryAxis();
+    m_chart->addAxis(m_periodAxis, Qt::AlignBottom);
+    m_series->attachAxis(m_periodAxis);
+
+    m_valueAxis = new QValueAxis();
+    m_chart->addAxis(m_valueAxis, Qt::AlignLeft);
+    m_series->attachAxis(m_valueAxis);
+
+    m_chartView = new QChartView(m_chart);
+    m_chartView->setRenderHint(QPainter::Antialiasing);
+
+    mainLayout->addLayout(controlsLayout);
+    mainLayout->addWidget(m_chartView);
+
+    // Connect signals
+    connect(m_periodCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &VolumeTab::refresh);
+    connect(m_measureCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &VolumeTab::refresh);
+}
+
+void VolumeTab::setDateRange(const QDate &startDate, const QDate &endDate)
+{
+    m_startDate = startDate;
+    m_endDate = endDate;
+}
+
+double VolumeTab::measureOf(const VolumeRollup::Totals &totals, Measure measure)
+{
+    switch (measure) {
+    case Sets:
+        return totals.sets;
+    case Reps:
+        return totals.reps;
+    case Volume:
+        break;
+    }
+    return totals.volume;
+}
+
+int VolumeTab::periodCount(VolumeRollup::Period period, const QDate &first, const QDate &last)
+{
+    QDate from = VolumeRollup::periodStart(first, period);
+    QDate to = VolumeRollup::periodStart(last, period);
+    if (period == VolumeRollup::Week) {
+        return int(from.daysTo(to) / 7) + 1;
+    }
+    return (to.year() - from.year()) * 12 + to.month() - from.month() + 1;
+}
+
+void VolumeTab::refresh()
+{
+    TRACE_SCOPE("VolumeTab::refresh");
+    VolumeRollup::Period period = static_cast<VolumeRollup::Period>(m_periodCombo->currentData().toInt());
+    Measure measure = static_cast<Measure>(m_measureCombo->currentData().toInt());
+    QList<VolumeRollup::Bucket> buckets = m_dataManager->getVolumeRollup(period, m_startDate, m_endDate);
+
+    // Only categories trained in the range get a bar set and legend entry
+    QStringList categories;
+    for (const VolumeRollup::Bucket &bucket : buckets) {
+        for (auto it = bucket.byCategory.constBegin(); it != bucket.byCategory.constEnd(); ++it) {
+            if (!it.value().isEmpty() && !categories.contains(it.key())) {
+                categories.append(it.key());
+            }
+        }
+    }
+    std::sort(categories.begin(), categories.end());
+
+    // One bar set per category with a value per bucket (500+ for ten years
+    // of weeks); the sets are rebuilt from scratch on each refresh
+    m_series->clear();
+    m_periodAxis->clear();
+
+    QStringList labels;
+    labels.reserve(buckets.size());
+    for (const VolumeRollup::Bucket &bucket : buckets) {
+        // QBarCategoryAxis drops duplicate labels, so weeks carry the year
+        labels.append(period == VolumeRollup::Week ? bucket.periodStart.toString("MMM dd yyyy")
+                                                   : bucket.periodStart.toString("MMM yyyy"));
+    }
+
+    double maxTotal = 0.0;
+    QList<double> periodTotals(buckets.size(), 0.0);
+    for (const QString &category : categories) {
+        QList<qreal> values;
+        values.reserve(buckets.size());
+        for (int i = 0; i < buckets.size(); ++i) {
+            double value = measureOf(buckets[i].byCategory.value(category), measure);
+            values.append(value);
+            periodTotals[i] += value;
+        }
+
+        QBarSet *set = new QBarSet(category);
+        set->append(values);
+        m_series->append(set);
+    }
+    for (double total : periodTotals) {
+        maxTotal = qMax(maxTotal, total);
+    }
+
+    m_periodAxis->append(labels);
+    m_valueAxis->setRange(0, maxTotal > 0 ? maxTotal * 1.1 : 10);
+    m_valueAxis->setTitleText(m_measureCombo->currentText());
+
+    if (buckets.isEmpty()) {
+        m_summaryLabel->setText("No workouts in this period");
+        return;
+    }
+
+    double sum = 0.0;
+    for (double total : periodTotals) {
+        sum += total;
+    }
+
+    // Weeks or months without workouts have no bucket but still count; an
+    // open range runs from the first workout to today
+    QDate first = m_startDate.isValid() ? m_startDate : buckets.first().periodStart;
+    QDate last = m_endDate.isValid() ? m_endDate : qMax(buckets.last().periodStart, QDate::currentDate());
+    int periods = qMax(1, periodCount(period, first, last));
+    m_summaryLabel->setText(QString("Average per %1: %2")
+                                .arg(period == VolumeRollup::Week ? "week" : "month")
+                                .arg(sum / periods, 0, 'f', measure == Volume ? 0 : 1));
+}
@@ -0,0 +1,58 @@
+#ifndef VOLUMETAB_H
+#define VOLUMETAB_H
+
+#include <QWidget>
+#include <QDate>
+#include <QtCharts/QChartView>
+#include <QtCharts/QChart>
+#include <QtCharts/QStackedBarSeries>
+#include <QtCharts/QBarCategoryAxis>
+#include <QtCharts/QValueAxis>
+#include <QLabel>
+#include <QComboBox>
+#include "models/datamanager.h"
+
+// Training volume stacked by exercise category per week or month, read
+// straight from DataManager's materialized rollups.
+class VolumeTab : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit VolumeTab(DataManager *dataManager, QWidget *parent = nullptr);
+
+    // Invalid dates leave that side of the range open ("All Time")
+    void setDateRange(const QDate &startDate, const QDate &endDate);
+
+public slots:
+    void refresh();
+
+private:
+    enum Measure {
+        Volume,
+        Sets,
+        Reps
+    };
+
+    void setupUI();
+    static double measureOf(const VolumeRollup::Totals &totals, Measure measure);
+    static int periodCount(VolumeRollup::Period period, const QDate &first, const QDate &last);
+
+    DataManager *m_dataManager;
+    QDate m_startDate;
+    QDate m_endDate;
+
+    // UI Components
+    QComboBox *m_periodCombo;
+    QComboBox *m_measureCombo;
+    QLabel *m_summaryLabel;
+
+    // Chart
+    QChartView *m_chartView;
+    QChart *m_chart;
+    QStackedBarSeries *m_series;
+    QBarCategoryAxis *m_periodAxis;
+    QValueAxis *m_valueAxis;
+};
+
+#endif // VOLUMETAB_H
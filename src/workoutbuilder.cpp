@@ -1,4 +1,6 @@
 #include "workoutbuilder.h"
+#include "exercisecompleter.h"
+#include <QHash>
 #include <QDebug>
 #include <QMessageBox>
 #include <QKeyEvent>
@@ -9,9 +11,9 @@ WorkoutBuilder::WorkoutBuilder(DataManager *dataManager, QWidget *parent)
     , m_dataManager(dataManager)
     , m_currentDate(QDate::currentDate())
     , m_editingWorkoutId(0)
+    , m_exerciseProxy(nullptr)
 {
     setupUI();
-    updateExerciseComboBox();
 }
 
 void WorkoutBuilder::setDate(const QDate &date)
@@ -29,6 +31,12 @@ void WorkoutBuilder::setupUI()
     QVBoxLayout *mainLayout = new QVBoxLayout(this);
     mainLayout->setContentsMargins(40, 20, 40, 20);
     
+    // Exercise choices follow the library model as it changes
+    m_exerciseProxy = new ExerciseFilterModel(this);
+    m_exerciseProxy->setSourceModel(m_dataManager->getExerciseModel());
+    m_exerciseProxy->setActiveOnly(true);
+    m_exerciseProxy->sort(ExerciseModel::NameColumn);
+    
     // Workout notes section
     QGroupBox *notesGroup = new QGroupBox("Workout Notes (Optional)");
     QVBoxLayout *notesLayout = new QVBoxLayout(notesGroup);
@@ -86,35 +94,35 @@ void WorkoutBuilder::setupUI()
     setLayout(mainLayout);
 }
 
-void WorkoutBuilder::updateExerciseComboBox()
-{
-    m_availableExercises = m_dataManager->getAllExercises();
-    
-    // Update all existing combo boxes
-    for (ExerciseRow &row : m_exerciseRows) {
-        row.exerciseCombo->clear();
-        row.exerciseCombo->addItem("Select an exercise", -1);
-        
-        for (const Exercise &exercise : m_availableExercises) {
-            if (exercise.isActive()) {
-                row.exerciseCombo->addItem(exercise.name(), exercise.id());
-            }
-        }
-    }
-}
-
 void WorkoutBuilder::addExerciseRow()
 {
     ExerciseRow row;
     
-    // Exercise selection
-    row.exerciseCombo = new QComboBox();
-    row.exerciseCombo->addItem("Select an exercise", -1);
-    for (const Exercise &exercise : m_availableExercises) {
-        if (exercise.isActive()) {
-            row.exerciseCombo->addItem(exercise.name(), exercise.id());
+    // Exercise selection; typing searches the library
+    QComboBox *combo = new QComboBox();
+    combo->setModel(m_exerciseProxy);
+    combo->setModelColumn(ExerciseModel::NameColumn);
+    combo->setEditable(true);
+    combo->setInsertPolicy(QComboBox::NoInsert);
+    combo->lineEdit()->setPlaceholderText("Select an exercise");
+    combo->setCurrentIndex(-1);
+    
+    ExerciseCompleter *completer = new ExerciseCompleter(m_dataManager, combo->lineEdit());
+    combo->setCompleter(completer);
+    
+    // The combo box picks the first exercise with the completed name; queued
+    // so the id of the chosen match wins when two exercises share a name
+    connect(completer, &ExerciseCompleter::exerciseActivated, combo, [combo](int exerciseId) {
+        combo->setCurrentIndex(combo->findData(exerciseId));
+    }, Qt::QueuedConnection);
+    connect(combo->lineEdit(), &QLineEdit::editingFinished, combo, [combo]() {
+        // Text that doesn't name an exercise clears the selection
+        if (combo->currentIndex() >= 0 && combo->itemText(combo->currentIndex()) == combo->currentText()) {
+            return;
         }
-    }
+        combo->setCurrentIndex(combo->findText(combo->currentText(), Qt::MatchFixedString));
+    });
+    row.exerciseCombo = combo;
     
     // Weight input (text input instead of spinner)
     row.weightEdit = new QLineEdit();
@@ -183,14 +191,7 @@ void WorkoutBuilder::saveWorkout()
     for (const ExerciseRow &row : m_exerciseRows) {
         int exerciseId = row.exerciseCombo->currentData().toInt();
         if (exerciseId > 0) {
-            // Find exercise name
-            QString exerciseName;
-            for (const Exercise &exercise : m_availableExercises) {
-                if (exercise.id() == exerciseId) {
-                    exerciseName = exercise.name();
-                    break;
-                }
-            }
+            QString exerciseName = m_dataManager->loadExercise(exerciseId).name();
             
             // Get values from text inputs
             double weight = row.weightEdit->text().toDouble();
@@ -210,10 +211,40 @@ void WorkoutBuilder::saveWorkout()
         }
     }
     
+    // Records as they stand before the save, so only improvements are
+    // announced (not records an edited or re-saved workout already held)
+    QHash<int, PersonalRecordIndex::Records> recordsBefore;
+    for (const WorkoutExercise &exercise : workout.exercises()) {
+        if (!recordsBefore.contains(exercise.exerciseId())) {
+            recordsBefore.insert(exercise.exerciseId(), m_dataManager->getPersonalRecords(exercise.exerciseId()));
+        }
+    }
+    
     // Save workout
-    if (m_dataManager->saveWorkout(workout)) {
+    int savedId = 0;
+    if (m_dataManager->saveWorkout(workout, &savedId)) {
+        workout.setId(savedId);
+        QList<PersonalRecordIndex::Achievement> achievements = m_dataManager->getPersonalRecordsSetBy(workout);
+        
         emit workoutCreated();
         clearForm();
+        
+        QStringList lines;
+        for (const PersonalRecordIndex::Achievement &achievement : achievements) {
+            if (!PersonalRecordIndex::improves(achievement, recordsBefore.value(achievement.exerciseId))) {
+                continue;
+            }
+            QString name = m_dataManager->getTrainedExerciseName(achievement.exerciseId);
+            QString type = PersonalRecordIndex::recordTypeName(achievement.type);
+            if (achievement.type == PersonalRecordIndex::MostRepsAtWeight) {
+                lines.append(QString("%1: %2 (%3 reps at %4 kg)").arg(name, type).arg(achievement.reps).arg(achievement.value));
+            } else {
+                lines.append(QString("%1: %2 (%3 kg)").arg(name, type).arg(achievement.value, 0, 'f', 1));
+            }
+        }
+        if (!lines.isEmpty()) {
+            showSuccess(QString("Workout saved. New personal records:\n%1").arg(lines.join("\n")));
+        }
     } else {
         showError("Failed to save workout. Please check your data.");
     }
@@ -228,9 +259,6 @@ void WorkoutBuilder::loadWorkoutData(const QList<Workout> &workouts)
         return;
     }
     
-    // Ensure exercise combo boxes are populated
-    updateExerciseComboBox();
-    
     // Load the first workout (assuming one workout per day for now)
     const Workout &workout = workouts.first();
     m_editingWorkoutId = workout.id(); // Set the workout ID we're editing
@@ -246,12 +274,7 @@ void WorkoutBuilder::loadWorkoutData(const QList<Workout> &workouts)
         ExerciseRow &row = m_exerciseRows[i];
         
         // Set exercise name
-        for (int j = 0; j < row.exerciseCombo->count(); ++j) {
-            if (row.exerciseCombo->itemData(j).toInt() == exercise.exerciseId()) {
-                row.exerciseCombo->setCurrentIndex(j);
-                break;
-            }
-        }
+        row.exerciseCombo->setCurrentIndex(row.exerciseCombo->findData(exercise.exerciseId()));
         
         // Set exercise data (use first set for now)
         QList<SetData> sets = exercise.setsData();
@@ -274,7 +297,7 @@ void WorkoutBuilder::clearForm()
     
     // Clear all exercise rows
     for (ExerciseRow &row : m_exerciseRows) {
-        row.exerciseCombo->setCurrentIndex(0);
+        row.exerciseCombo->setCurrentIndex(-1);
         row.weightEdit->clear();
         row.repsEdit->clear();
         row.setsEdit->setText("1");
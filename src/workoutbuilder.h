@@ -36,9 +36,6 @@ signals:
     void workoutCreated();
     void cancelled();
 
-public slots:
-    void updateExerciseComboBox();
-
 private slots:
     void saveWorkout();
     void onCancelClicked();
@@ -71,7 +68,9 @@ private:
     };
     
     QList<ExerciseRow> m_exerciseRows;
-    QList<Exercise> m_availableExercises;
+    
+    // Active exercises by name, shared by every row's combo box
+    ExerciseFilterModel *m_exerciseProxy;
 };
 
 #endif // WORKOUTBUILDER_H 
\ No newline at end of file
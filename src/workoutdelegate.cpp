@@ -0,0 +1,116 @@
+#include "workoutdelegate.h"
+#include "workoutlistmodel.h"
+#include <QPainter>
+#include <QFontMetrics>
+#include <QAbstractItemView>
+
+namespace {
+constexpr int kHorizontalMargin = 8;
+}
+
+WorkoutDelegate::WorkoutDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+{
+}
+
+WorkoutDelegate::RowStyle WorkoutDelegate::styleFor(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    RowStyle style;
+    style.font = option.font;
+    style.color = option.palette.color(QPalette::Text);
+
+    switch (index.data(WorkoutListModel::RowKindRole).toInt()) {
+    case WorkoutListModel::WorkoutHeaderRow:
+        style.font.setBold(true);
+        style.topMargin = index.row() == 0 ? 0 : 16;
+        style.padding = 6;
+        break;
+    case WorkoutListModel::WorkoutNotesRow:
+        style.background = QColor(0xf5, 0xf5, 0xf5);
+        style.padding = 8;
+        style.wrap = true;
+        break;
+    case WorkoutListModel::ExerciseHeaderRow:
+        style.font.setBold(true);
+        style.indent = 10;
+        style.topMargin = 8;
+        break;
+    case WorkoutListModel::SetRow:
+        style.indent = 24;
+        break;
+    case WorkoutListModel::RecordsRow:
+        style.indent = 24;
+        style.color = QColor(0xb8, 0x86, 0x0b);
+        style.wrap = true;
+        break;
+    case WorkoutListModel::ExerciseNotesRow:
+        style.indent = 24;
+        style.font.setItalic(true);
+        style.color = QColor(0x66, 0x66, 0x66);
+        style.wrap = true;
+        break;
+    }
+    return style;
+}
+
+int WorkoutDelegate::availableWidth(const QStyleOptionViewItem &option) const
+{
+    // QListView doesn't pass the row width to sizeHint, so use the viewport's
+    const QAbstractItemView *view = qobject_cast<const QAbstractItemView *>(option.widget);
+    return view ? view->viewport()->width() : option.rect.width();
+}
+
+QRect WorkoutDelegate::textRect(const RowStyle &style, const QRect &rowRect) const
+{
+    return rowRect.adjusted(kHorizontalMargin + style.indent + style.padding,
+                            style.topMargin + style.padding,
+                            -(kHorizontalMargin + style.padding),
+                            -style.padding);
+}
+
+void WorkoutDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    RowStyle style = styleFor(option, index);
+    QRect box = option.rect.adjusted(kHorizontalMargin + style.indent, style.topMargin, -kHorizontalMargin, 0);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+
+    if (style.background.isValid()) {
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(style.background);
+        painter->drawRoundedRect(box, 4, 4);
+    }
+
+    // Separator above each workout after the first
+    if (index.data(WorkoutListModel::RowKindRole).toInt() == WorkoutListModel::WorkoutHeaderRow && style.topMargin > 0) {
+        painter->setPen(QColor(0xdd, 0xdd, 0xdd));
+        painter->drawLine(box.left(), option.rect.top() + style.topMargin / 2,
+                          box.right(), option.rect.top() + style.topMargin / 2);
+    }
+
+    painter->setFont(style.font);
+    painter->setPen(style.color);
+    int flags = Qt::AlignLeft | Qt::AlignVCenter;
+    if (style.wrap) {
+        flags |= Qt::TextWordWrap;
+    }
+    painter->drawText(textRect(style, option.rect), flags, index.data(Qt::DisplayRole).toString());
+
+    painter->restore();
+}
+
+QSize WorkoutDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    RowStyle style = styleFor(option, index);
+    int width = availableWidth(option);
+    int textWidth = qMax(1, width - 2 * kHorizontalMargin - style.indent - 2 * style.padding);
+
+    QFontMetrics metrics(style.font);
+    QString text = index.data(Qt::DisplayRole).toString();
+    int textHeight = style.wrap
+                         ? metrics.boundingRect(QRect(0, 0, textWidth, 0), Qt::TextWordWrap, text).height()
+                         : metrics.height();
+
+    return QSize(width, style.topMargin + textHeight + 2 * style.padding);
+}
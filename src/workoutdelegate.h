@@ -0,0 +1,34 @@
+#ifndef WORKOUTDELEGATE_H
+#define WORKOUTDELEGATE_H
+
+#include <QStyledItemDelegate>
+
+// Paints WorkoutListModel rows directly with QPainter. Styling is keyed on the
+// row kind, so no per-row widgets or style sheets are created.
+class WorkoutDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit WorkoutDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    struct RowStyle {
+        QFont font;
+        QColor color;
+        QColor background;  // invalid for none
+        int indent = 0;
+        int topMargin = 0;
+        int padding = 2;
+        bool wrap = false;
+    };
+
+    RowStyle styleFor(const QStyleOptionViewItem &option, const QModelIndex &index) const;
+    int availableWidth(const QStyleOptionViewItem &option) const;
+    QRect textRect(const RowStyle &style, const QRect &rowRect) const;
+};
+
+#endif // WORKOUTDELEGATE_H
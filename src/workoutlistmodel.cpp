@@ -0,0 +1,145 @@
+#include "workoutlistmodel.h"
+
+WorkoutListModel::WorkoutListModel(DataManager *dataManager, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_dataManager(dataManager)
+    , m_date(QDate::currentDate())
+{
+    // Any save or delete may touch a prefetched day
+    connect(m_dataManager, &DataManager::dataChanged, this, &WorkoutListModel::clearPrefetched);
+}
+
+void WorkoutListModel::setDate(const QDate &date)
+{
+    if (date == m_date) {
+        refresh();
+        return;
+    }
+
+    Day day = m_prefetched.contains(date) ? m_prefetched.take(date) : buildDay(date);
+
+    // The day being left is adjacent to most next steps, so keep it
+    m_prefetched.insert(m_date, Day{m_workouts, m_rows});
+    for (auto it = m_prefetched.begin(); it != m_prefetched.end();) {
+        if (qAbs(it.key().daysTo(date)) > 1) {
+            it = m_prefetched.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    beginResetModel();
+    m_date = date;
+    m_workouts = day.workouts;
+    m_rows = day.rows;
+    endResetModel();
+}
+
+void WorkoutListModel::refresh()
+{
+    m_prefetched.clear();
+
+    Day day = buildDay(m_date);
+    beginResetModel();
+    m_workouts = day.workouts;
+    m_rows = day.rows;
+    endResetModel();
+}
+
+void WorkoutListModel::prefetch(const QDate &date)
+{
+    if (date.isValid() && date != m_date && !m_prefetched.contains(date)) {
+        m_prefetched.insert(date, buildDay(date));
+    }
+}
+
+int WorkoutListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+QVariant WorkoutListModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const Row &row = m_rows.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+        return row.text;
+    case RowKindRole:
+        return row.kind;
+    case WorkoutIdRole:
+        return row.workoutId;
+    default:
+        return QVariant();
+    }
+}
+
+WorkoutListModel::Day WorkoutListModel::buildDay(const QDate &date) const
+{
+    Day day;
+    day.workouts = m_dataManager->getWorkoutsByDate(date);
+    QList<Row> &rows = day.rows;
+
+    for (const Workout &workout : day.workouts) {
+        rows.append({WorkoutHeaderRow, workout.id(), QString("Workout · Status: %1").arg(workout.statusString())});
+
+        if (!workout.notes().isEmpty()) {
+            rows.append({WorkoutNotesRow, workout.id(), QString("Notes: %1").arg(workout.notes())});
+        }
+
+        const QList<WorkoutExercise> &exercises = workout.exercises();
+        for (int i = 0; i < exercises.size(); ++i) {
+            const WorkoutExercise &exercise = exercises.at(i);
+            rows.append({ExerciseHeaderRow, workout.id(), QString("%1. %2").arg(i + 1).arg(exercise.exerciseName())});
+
+            const QList<SetData> &sets = exercise.setsData();
+            for (int j = 0; j < sets.size(); ++j) {
+                const SetData &set = sets.at(j);
+                rows.append({SetRow, workout.id(), QString("Set %1: %2 kg × %3 reps × %4 sets")
+                                                         .arg(j + 1)
+                                                         .arg(set.weight())
+                                                         .arg(set.reps())
+                                                         .arg(set.sets())});
+            }
+
+            QString records = recordsText(exercise, workout.id());
+            if (!records.isEmpty()) {
+                rows.append({RecordsRow, workout.id(), records});
+            }
+
+            if (!exercise.notes().isEmpty()) {
+                rows.append({ExerciseNotesRow, workout.id(), QString("Notes: %1").arg(exercise.notes())});
+            }
+        }
+    }
+
+    return day;
+}
+
+QString WorkoutListModel::recordsText(const WorkoutExercise &exercise, int workoutId) const
+{
+    // Personal records, starred when this workout holds them
+    PersonalRecordIndex::Records records = m_dataManager->getPersonalRecords(exercise.exerciseId());
+    if (records.isEmpty()) {
+        return QString();
+    }
+
+    PersonalRecordIndex::RecordTypes held = records.heldBy(workoutId);
+    auto mark = [held](PersonalRecordIndex::RecordType type) {
+        return held.testFlag(type) ? QString(" ★") : QString();
+    };
+    QString text = QString("PRs: Heaviest %1 kg%2 · e1RM %3 kg%4 · Volume %5 kg%6")
+                       .arg(records.heaviestWeight.value)
+                       .arg(mark(PersonalRecordIndex::HeaviestWeight))
+                       .arg(records.bestOneRepMax.value, 0, 'f', 1)
+                       .arg(mark(PersonalRecordIndex::BestOneRepMax))
+                       .arg(records.bestVolume.value)
+                       .arg(mark(PersonalRecordIndex::BestVolume));
+    if (held.testFlag(PersonalRecordIndex::MostRepsAtWeight)) {
+        text += " · Rep PR ★";
+    }
+    return text;
+}
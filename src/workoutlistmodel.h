@@ -0,0 +1,68 @@
+#ifndef WORKOUTLISTMODEL_H
+#define WORKOUTLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QDate>
+#include <QList>
+#include <QMap>
+#include "models/datamanager.h"
+#include "models/workout.h"
+
+// Flattens the workouts of one day into display rows (workout header, notes,
+// exercise header, sets, records) for WorkoutView's list. Changing the date
+// resets the model; the view only creates paint work for visible rows.
+// Neighbouring days can be prefetched so stepping to them is a swap.
+class WorkoutListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum RowKind {
+        WorkoutHeaderRow,
+        WorkoutNotesRow,
+        ExerciseHeaderRow,
+        SetRow,
+        RecordsRow,
+        ExerciseNotesRow
+    };
+
+    enum Roles {
+        RowKindRole = Qt::UserRole + 1,
+        WorkoutIdRole
+    };
+
+    explicit WorkoutListModel(DataManager *dataManager, QObject *parent = nullptr);
+
+    void setDate(const QDate &date);
+    void refresh();
+    void prefetch(const QDate &date);
+    void clearPrefetched() { m_prefetched.clear(); }
+
+    const QList<Workout> &workouts() const { return m_workouts; }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    struct Row {
+        RowKind kind;
+        int workoutId;
+        QString text;
+    };
+
+    struct Day {
+        QList<Workout> workouts;
+        QList<Row> rows;
+    };
+
+    Day buildDay(const QDate &date) const;
+    QString recordsText(const WorkoutExercise &exercise, int workoutId) const;
+
+    DataManager *m_dataManager;
+    QDate m_date;
+    QList<Workout> m_workouts;
+    QList<Row> m_rows;
+    QMap<QDate, Day> m_prefetched;  // days adjacent to m_date
+};
+
+#endif // WORKOUTLISTMODEL_H
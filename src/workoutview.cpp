@@ -1,4 +1,7 @@
 #include "workoutview.h"
+#include "workoutlistmodel.h"
+#include "workoutdelegate.h"
+#include "utils/trace.h"
 #include <QMessageBox>
 #include <QDebug>
 
@@ -6,20 +9,38 @@ WorkoutView::WorkoutView(DataManager *dataManager, QWidget *parent)
     : QWidget(parent)
     , m_dataManager(dataManager)
     , m_currentDate(QDate::currentDate())
+    , m_noWorkoutsLabel(nullptr)
+    , m_workoutsList(nullptr)
+    , m_editButton(nullptr)
+    , m_deleteButton(nullptr)
+    , m_model(nullptr)
 {
     setupUI();
 }
 
 void WorkoutView::setDate(const QDate &date)
 {
+    TRACE_SCOPE("WorkoutView::setDate");
     m_currentDate = date;
-    refreshData();
+    m_model->setDate(date);
+    updateVisibility();
 }
 
 void WorkoutView::refreshData()
 {
-    m_currentWorkouts = m_dataManager->getWorkoutsByDate(m_currentDate);
-    displayWorkouts();
+    TRACE_SCOPE("WorkoutView::refreshData");
+    m_model->refresh();
+    updateVisibility();
+}
+
+void WorkoutView::prefetch(const QDate &date)
+{
+    m_model->prefetch(date);
+}
+
+bool WorkoutView::hasWorkouts() const
+{
+    return !m_model->workouts().isEmpty();
 }
 
 void WorkoutView::setupUI()
@@ -33,12 +54,20 @@ void WorkoutView::setupUI()
     m_noWorkoutsLabel->setStyleSheet("QLabel { color: #666; font-size: 14px; padding: 20px; }");
     mainLayout->addWidget(m_noWorkoutsLabel);
     
-    // Workouts container
-    m_workoutsContainer = new QWidget();
-    QVBoxLayout *containerLayout = new QVBoxLayout(m_workoutsContainer);
-    containerLayout->setAlignment(Qt::AlignTop);
+    // Workouts list; rows are painted by the delegate, only when visible
+    m_model = new WorkoutListModel(m_dataManager, this);
+    m_workoutsList = new QListView();
+    m_workoutsList->setModel(m_model);
+    m_workoutsList->setItemDelegate(new WorkoutDelegate(m_workoutsList));
+    m_workoutsList->setSelectionMode(QAbstractItemView::NoSelection);
+    m_workoutsList->setFocusPolicy(Qt::NoFocus);
+    m_workoutsList->setFrameShape(QFrame::NoFrame);
+    m_workoutsList->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    m_workoutsList->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    m_workoutsList->setResizeMode(QListView::Adjust);
+    m_workoutsList->setStyleSheet("QListView { background: transparent; }");
     
-    mainLayout->addWidget(m_workoutsContainer);
+    mainLayout->addWidget(m_workoutsList, 1);
     
     // Create buttons
     m_editButton = new QPushButton("Edit", this);
@@ -55,127 +84,20 @@ void WorkoutView::setupUI()
     buttonLayout->addWidget(m_deleteButton);
     buttonLayout->addWidget(m_editButton);
     
-    mainLayout->addStretch();
     mainLayout->addLayout(buttonLayout);
     
     // Initial data load
-    refreshData();
-}
-
-void WorkoutView::displayWorkouts()
-{
-    clearWorkouts();
-    
-    if (m_currentWorkouts.isEmpty()) {
-        m_noWorkoutsLabel->show();
-        m_workoutsContainer->hide();
-        m_editButton->hide();
-        m_deleteButton->hide();
-        return;
-    }
-    
-    m_noWorkoutsLabel->hide();
-    m_workoutsContainer->show();
-    m_editButton->show();
-    m_deleteButton->show();
-    
-    QVBoxLayout *containerLayout = qobject_cast<QVBoxLayout*>(m_workoutsContainer->layout());
-    
-    // Defensive programming: try to display workouts, but catch any crashes
-    try {
-    
-    for (const Workout &workout : m_currentWorkouts) {
-        // Create workout group
-        QGroupBox *workoutGroup = new QGroupBox("Workout");
-        workoutGroup->setStyleSheet("QGroupBox { font-weight: bold; margin-top: 10px; }");
-        
-        QVBoxLayout *workoutLayout = new QVBoxLayout(workoutGroup);
-        
-        // Workout info
-        QHBoxLayout *infoLayout = new QHBoxLayout();
-        
-        QLabel *statusLabel = new QLabel(QString("Status: %1").arg(workout.statusString()));
-        statusLabel->setStyleSheet("QLabel { font-weight: normal; }");
-        
-        infoLayout->addWidget(statusLabel);
-        infoLayout->addStretch();
-        
-        workoutLayout->addLayout(infoLayout);
-        
-        // Workout notes
-        if (!workout.notes().isEmpty()) {
-            QLabel *notesLabel = new QLabel(QString("Notes: %1").arg(workout.notes()));
-            notesLabel->setWordWrap(true);
-            notesLabel->setStyleSheet("QLabel { font-weight: normal; background-color: #f5f5f5; padding: 8px; border-radius: 4px; }");
-            workoutLayout->addWidget(notesLabel);
-        }
-        
-        // Exercises - defensive copy to prevent segfault
-        const QList<WorkoutExercise> exercises = workout.exercises();
-        if (!exercises.isEmpty()) {
-            QLabel *exercisesLabel = new QLabel("Exercises:");
-            exercisesLabel->setStyleSheet("QLabel { font-weight: bold; margin-top: 10px; }");
-            workoutLayout->addWidget(exercisesLabel);
-            
-            for (int i = 0; i < exercises.size(); ++i) {
-                const WorkoutExercise &exercise = exercises[i];
-                
-                QGroupBox *exerciseGroup = new QGroupBox(QString("%1. %2").arg(i + 1).arg(exercise.exerciseName()));
-                exerciseGroup->setStyleSheet("QGroupBox { font-weight: normal; margin: 5px; }");
-                
-                QVBoxLayout *exerciseLayout = new QVBoxLayout(exerciseGroup);
-                
-                // Exercise details - defensive copy to prevent segfault
-                const QList<SetData> sets = exercise.setsData();
-                if (!sets.isEmpty()) {
-                    for (int j = 0; j < sets.size(); ++j) {
-                        const SetData &set = sets.at(j);
-                        QString setText = QString("Set %1: %2 kg × %3 reps × %4 sets")
-                                            .arg(j + 1)
-                                            .arg(set.weight())
-                                            .arg(set.reps())
-                                            .arg(set.sets());
-                        
-                        QLabel *setLabel = new QLabel(setText);
-                        setLabel->setStyleSheet("QLabel { margin-left: 10px; }");
-                        exerciseLayout->addWidget(setLabel);
-                    }
-                }
-                
-                // Exercise notes
-                if (!exercise.notes().isEmpty()) {
-                    QLabel *exerciseNotesLabel = new QLabel(QString("Notes: %1").arg(exercise.notes()));
-                    exerciseNotesLabel->setWordWrap(true);
-                    exerciseNotesLabel->setStyleSheet("QLabel { margin-left: 10px; font-style: italic; color: #666; }");
-                    exerciseLayout->addWidget(exerciseNotesLabel);
-                }
-                
-                workoutLayout->addWidget(exerciseGroup);
-            }
-        }
-        
-        containerLayout->addWidget(workoutGroup);
-    }
-    } catch (...) {
-        // If there's any crash while displaying workouts, show error message
-        QLabel *errorLabel = new QLabel("Error displaying workout data");
-        errorLabel->setStyleSheet("QLabel { color: red; font-weight: bold; padding: 10px; }");
-        containerLayout->addWidget(errorLabel);
-    }
+    m_model->setDate(m_currentDate);
+    updateVisibility();
 }
 
-void WorkoutView::clearWorkouts()
+void WorkoutView::updateVisibility()
 {
-    QVBoxLayout *containerLayout = qobject_cast<QVBoxLayout*>(m_workoutsContainer->layout());
-    if (containerLayout) {
-        QLayoutItem *item;
-        while ((item = containerLayout->takeAt(0)) != nullptr) {
-            if (item->widget()) {
-                item->widget()->deleteLater();
-            }
-            delete item;
-        }
-    }
+    bool hasWorkouts = this->hasWorkouts();
+    m_noWorkoutsLabel->setVisible(!hasWorkouts);
+    m_workoutsList->setVisible(hasWorkouts);
+    m_editButton->setVisible(hasWorkouts);
+    m_deleteButton->setVisible(hasWorkouts);
 }
 
 void WorkoutView::onEditClicked()
@@ -185,7 +107,8 @@ void WorkoutView::onEditClicked()
 
 void WorkoutView::onDeleteClicked()
 {
-    if (m_currentWorkouts.isEmpty()) {
+    const QList<Workout> workouts = m_model->workouts();
+    if (workouts.isEmpty()) {
         return;
     }
     
@@ -198,7 +121,7 @@ void WorkoutView::onDeleteClicked()
     
     if (reply == QMessageBox::Yes) {
         // Delete all workouts for this date
-        for (const Workout &workout : m_currentWorkouts) {
+        for (const Workout &workout : workouts) {
             m_dataManager->deleteWorkout(workout.id());
         }
         emit deleteRequested();
@@ -6,11 +6,11 @@
 #include <QHBoxLayout>
 #include <QLabel>
 #include <QPushButton>
-#include <QGroupBox>
+#include <QListView>
 #include <QDate>
-#include <QList>
 #include "models/datamanager.h"
-#include "models/workout.h"
+
+class WorkoutListModel;
 
 class WorkoutView : public QWidget
 {
@@ -21,6 +21,8 @@ public:
     
     void setDate(const QDate &date);
     void refreshData();
+    void prefetch(const QDate &date);
+    bool hasWorkouts() const;
 
 signals:
     void editRequested();
@@ -32,18 +34,17 @@ private slots:
 
 private:
     void setupUI();
-    void displayWorkouts();
-    void clearWorkouts();
+    void updateVisibility();
     
     DataManager *m_dataManager;
     QDate m_currentDate;
     
     // UI elements
     QLabel *m_noWorkoutsLabel;
-    QWidget *m_workoutsContainer;
+    QListView *m_workoutsList;
     QPushButton *m_editButton;
     QPushButton *m_deleteButton;
-    QList<Workout> m_currentWorkouts;
+    WorkoutListModel *m_model;
 };
 
 #endif // WORKOUTVIEW_H 
\ No newline at end of file
@@ -0,0 +1,287 @@
+// Applies random workout and body composition saves and deletes to the
+// incrementally maintained indexes, in the order DataManager patches them,
+// and checks each one against an instance rebuilt from scratch.
+//
+// Usage: test-incremental-indexes [--steps <n>] [--seed <n>]
+
+#include <QCoreApplication>
+#include <QList>
+#include <QMap>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QtMath>
+#include <algorithm>
+#include "models/bodycomposition.h"
+#include "models/bodycompositionindex.h"
+#include "models/personalrecordindex.h"
+#include "models/strengthindex.h"
+#include "models/trainingload.h"
+#include "models/workout.h"
+
+namespace {
+
+const int kExerciseCount = 6;
+const int kHistoryDays = 240;
+
+QTextStream &err()
+{
+    static QTextStream stream(stderr);
+    return stream;
+}
+
+int s_failures = 0;
+
+void fail(int step, const QString &what)
+{
+    if (s_failures < 20) {
+        err() << "step " << step << ": " << what << Qt::endl;
+    }
+    ++s_failures;
+}
+
+bool near(double a, double b)
+{
+    return qAbs(a - b) <= 1e-6 * qMax(1.0, qMax(qAbs(a), qAbs(b)));
+}
+
+Workout randomWorkout(QRandomGenerator &rng, int id, const QDate &today)
+{
+    Workout workout(id, today.addDays(-rng.bounded(kHistoryDays)));
+
+    int exercises = 1 + rng.bounded(3);
+    for (int i = 0; i < exercises; ++i) {
+        int exerciseId = 1 + rng.bounded(kExerciseCount);
+        QList<SetData> sets;
+        int setCount = rng.bounded(4);
+        for (int s = 0; s < setCount; ++s) {
+            double weight = 2.5 * (4 + rng.bounded(40));
+            sets.append(SetData(weight, 1 + rng.bounded(12), 1 + rng.bounded(3)));
+        }
+        workout.addExercise(WorkoutExercise(i + 1, id, exerciseId,
+                                            QString("Exercise %1").arg(exerciseId), sets));
+    }
+    return workout;
+}
+
+BodyComposition randomComposition(QRandomGenerator &rng, const QDate &today)
+{
+    return BodyComposition(today.addDays(-rng.bounded(kHistoryDays)),
+                           160.0 + rng.bounded(60.0), 30.0 + rng.bounded(12.0),
+                           64.0 + rng.bounded(12.0), 14.0 + rng.bounded(4.0));
+}
+
+bool sameRecord(const PersonalRecordIndex::Record &a, const PersonalRecordIndex::Record &b)
+{
+    return a.workoutId == b.workoutId && a.date == b.date && near(a.value, b.value);
+}
+
+void compareStrength(int step, const StrengthIndex &incremental, const StrengthIndex &rebuilt)
+{
+    QList<int> ids = incremental.exerciseIds();
+    QList<int> expectedIds = rebuilt.exerciseIds();
+    std::sort(ids.begin(), ids.end());
+    std::sort(expectedIds.begin(), expectedIds.end());
+    if (ids != expectedIds) {
+        fail(step, "StrengthIndex exercise ids differ");
+        return;
+    }
+
+    for (int id : ids) {
+        QList<StrengthIndex::Session> sessions = incremental.sessions(id);
+        QList<StrengthIndex::Session> expected = rebuilt.sessions(id);
+        if (sessions.size() != expected.size()) {
+            fail(step, QString("StrengthIndex exercise %1: %2 sessions, expected %3")
+                           .arg(id).arg(sessions.size()).arg(expected.size()));
+            continue;
+        }
+        for (qsizetype i = 0; i < sessions.size(); ++i) {
+            const StrengthIndex::Session &a = sessions.at(i);
+            const StrengthIndex::Session &b = expected.at(i);
+            if (a.workoutId != b.workoutId || a.date != b.date || !near(a.volume, b.volume)
+                || !near(a.topWeight, b.topWeight) || !near(a.bestEpley, b.bestEpley)) {
+                fail(step, QString("StrengthIndex exercise %1: session %2 differs").arg(id).arg(i));
+            }
+        }
+    }
+}
+
+void compareRecords(int step, const PersonalRecordIndex &incremental, const PersonalRecordIndex &rebuilt)
+{
+    for (int id = 1; id <= kExerciseCount; ++id) {
+        PersonalRecordIndex::Records a = incremental.records(id);
+        PersonalRecordIndex::Records b = rebuilt.records(id);
+
+        bool same = a.isEmpty() == b.isEmpty()
+                    && sameRecord(a.heaviestWeight, b.heaviestWeight)
+                    && sameRecord(a.bestOneRepMax, b.bestOneRepMax)
+                    && sameRecord(a.bestVolume, b.bestVolume)
+                    && a.bestRepsAtWeight.keys() == b.bestRepsAtWeight.keys();
+        for (auto it = a.bestRepsAtWeight.constBegin(); same && it != a.bestRepsAtWeight.constEnd(); ++it) {
+            const PersonalRecordIndex::RepRecord &expected = b.bestRepsAtWeight.value(it.key());
+            same = it->reps == expected.reps && it->date == expected.date && it->workoutId == expected.workoutId;
+        }
+        if (!same) {
+            fail(step, QString("PersonalRecordIndex exercise %1 differs").arg(id));
+        }
+    }
+}
+
+// Fitness, fatigue and performance depend on the fitted parameters, which
+// the incremental side only refreshes on refit()
+void compareLoad(int step, const TrainingLoad &incremental, const TrainingLoad &rebuilt, bool fitted)
+{
+    QList<TrainingLoad::Day> days = incremental.days();
+    QList<TrainingLoad::Day> expected = rebuilt.days();
+    if (days.size() != expected.size()) {
+        fail(step, QString("TrainingLoad: %1 days, expected %2").arg(days.size()).arg(expected.size()));
+        return;
+    }
+
+    for (qsizetype i = 0; i < days.size(); ++i) {
+        const TrainingLoad::Day &a = days.at(i);
+        const TrainingLoad::Day &b = expected.at(i);
+        bool same = a.date == b.date && near(a.load, b.load) && near(a.acute, b.acute)
+                    && near(a.chronic, b.chronic) && near(a.ratio, b.ratio);
+        if (fitted) {
+            same = same && near(a.fitness, b.fitness) && near(a.fatigue, b.fatigue)
+                   && near(a.performance, b.performance);
+        }
+        if (!same) {
+            fail(step, QString("TrainingLoad: day %1 differs").arg(a.date.toString(Qt::ISODate)));
+            return;
+        }
+    }
+
+    if (fitted) {
+        TrainingLoad::Parameters a = incremental.parameters();
+        TrainingLoad::Parameters b = rebuilt.parameters();
+        if (a.fitted != b.fitted || a.observations != b.observations || !near(a.fitnessDecay, b.fitnessDecay)
+            || !near(a.fatigueDecay, b.fatigueDecay) || !near(a.k1, b.k1) || !near(a.k2, b.k2)) {
+            fail(step, "TrainingLoad: fitted parameters differ");
+        }
+    }
+}
+
+void compareBodyComposition(int step, QRandomGenerator &rng, const QDate &today,
+                            const BodyCompositionIndex &incremental, const BodyCompositionIndex &rebuilt)
+{
+    if (incremental.size() != rebuilt.size()) {
+        fail(step, QString("BodyCompositionIndex: %1 entries, expected %2")
+                       .arg(incremental.size()).arg(rebuilt.size()));
+        return;
+    }
+
+    for (int query = 0; query < 8; ++query) {
+        // Query 0 covers the whole history
+        QDate start = query == 0 ? QDate() : today.addDays(-rng.bounded(kHistoryDays + 10));
+        QDate end = query == 0 ? QDate() : start.addDays(rng.bounded(kHistoryDays));
+        for (int metric = 0; metric < BodyCompositionIndex::MetricCount; ++metric) {
+            auto m = static_cast<BodyCompositionIndex::Metric>(metric);
+            BodyCompositionIndex::RangeStats a = incremental.stats(m, start, end);
+            BodyCompositionIndex::RangeStats b = rebuilt.stats(m, start, end);
+            if (a.count != b.count || !near(a.mean, b.mean) || !near(a.variance, b.variance)
+                || !near(a.min, b.min) || !near(a.max, b.max)) {
+                fail(step, QString("BodyCompositionIndex: metric %1 over %2..%3 differs")
+                               .arg(metric).arg(start.toString(Qt::ISODate), end.toString(Qt::ISODate)));
+            }
+        }
+    }
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QStringList arguments = app.arguments();
+
+    int steps = 400;
+    quint32 seed = 1;
+    int stepsIndex = arguments.indexOf("--steps");
+    if (stepsIndex >= 0 && stepsIndex + 1 < arguments.size()) {
+        steps = arguments.at(stepsIndex + 1).toInt();
+    }
+    int seedIndex = arguments.indexOf("--seed");
+    if (seedIndex >= 0 && seedIndex + 1 < arguments.size()) {
+        seed = arguments.at(seedIndex + 1).toUInt();
+    }
+
+    QRandomGenerator rng(seed);
+    const QDate today = QDate::currentDate();
+
+    QMap<int, Workout> workouts;
+    StrengthIndex strength;
+    PersonalRecordIndex records(&strength);
+    TrainingLoad load(&strength);
+    int nextWorkoutId = 1;
+
+    QMap<QDate, BodyComposition> compositions;
+    BodyCompositionIndex bodyComposition;
+
+    for (int step = 1; step <= steps; ++step) {
+        // Saves outnumber deletes so the history grows; a save over an
+        // existing id is an edit, which DataManager applies as remove + add
+        if (workouts.isEmpty() || rng.bounded(3) != 0) {
+            int id = nextWorkoutId;
+            if (!workouts.isEmpty() && rng.bounded(4) == 0) {
+                id = workouts.keys().at(rng.bounded(int(workouts.size())));
+                Workout existing = workouts.value(id);
+                records.removeWorkout(existing);
+                strength.removeWorkout(existing);
+                load.removeWorkout(existing);
+            } else {
+                ++nextWorkoutId;
+            }
+            Workout workout = randomWorkout(rng, id, today);
+            workouts[id] = workout;
+            strength.addWorkout(workout);
+            records.addWorkout(workout);
+            load.addWorkout(workout);
+        } else {
+            int id = workouts.keys().at(rng.bounded(int(workouts.size())));
+            Workout workout = workouts.take(id);
+            records.removeWorkout(workout);
+            strength.removeWorkout(workout);
+            load.removeWorkout(workout);
+        }
+
+        if (compositions.isEmpty() || rng.bounded(3) != 0) {
+            BodyComposition composition = randomComposition(rng, today);
+            compositions[composition.date()] = composition;
+            bodyComposition.upsert(composition);
+        } else {
+            QDate date = compositions.keys().at(rng.bounded(int(compositions.size())));
+            compositions.remove(date);
+            bodyComposition.remove(date);
+        }
+
+        StrengthIndex freshStrength;
+        freshStrength.rebuild(workouts);
+        PersonalRecordIndex freshRecords(&freshStrength);
+        freshRecords.rebuild();
+        TrainingLoad freshLoad(&freshStrength);
+        freshLoad.rebuild(workouts);
+
+        // Fitting is the slow part, so the fitted fields are checked every
+        // so often rather than on every step
+        bool fitted = step % 25 == 0 || step == steps;
+        if (fitted) {
+            load.refit();
+        }
+
+        compareStrength(step, strength, freshStrength);
+        compareRecords(step, records, freshRecords);
+        compareLoad(step, load, freshLoad, fitted);
+
+        BodyCompositionIndex freshBodyComposition;
+        freshBodyComposition.rebuild(compositions);
+        compareBodyComposition(step, rng, today, bodyComposition, freshBodyComposition);
+    }
+
+    if (s_failures > 0) {
+        err() << s_failures << " mismatches over " << steps << " steps (seed " << seed << ")" << Qt::endl;
+        return 1;
+    }
+    QTextStream(stdout) << "test-incremental-indexes: " << steps << " steps, all indexes match" << Qt::endl;
+    return 0;
+}
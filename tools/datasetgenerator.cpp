@@ -0,0 +1,342 @@
+#include "datasetgenerator.h"
+#include "models/bodycomposition.h"
+#include "models/exercise.h"
+#include "models/workout.h"
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QRandomGenerator>
+#include <QTime>
+#include <QtMath>
+
+namespace {
+
+enum Day { Push, Pull, Legs };
+
+struct CatalogEntry {
+    const char *name;
+    const char *category;
+    int day;            // Push/Pull/Legs, or -1 for finishers
+    double startLoad;   // typical working weight in kg (as sets store it), 0 for bodyweight
+};
+
+const CatalogEntry Catalog[] = {
+    {"Bench Press", "strength", Push, 60},
+    {"Incline Bench Press", "strength", Push, 50},
+    {"Dumbbell Bench Press", "strength", Push, 22.5},
+    {"Overhead Press", "strength", Push, 40},
+    {"Dumbbell Shoulder Press", "strength", Push, 17.5},
+    {"Lateral Raise", "strength", Push, 7.5},
+    {"Dips", "strength", Push, 0},
+    {"Push-Up", "strength", Push, 0},
+    {"Cable Fly", "strength", Push, 12.5},
+    {"Triceps Pushdown", "strength", Push, 17.5},
+    {"Skull Crusher", "strength", Push, 22.5},
+    {"Close-Grip Bench Press", "strength", Push, 50},
+    {"Deadlift", "strength", Pull, 85},
+    {"Barbell Row", "strength", Pull, 50},
+    {"Pull-Up", "strength", Pull, 0},
+    {"Chin-Up", "strength", Pull, 0},
+    {"Lat Pulldown", "strength", Pull, 45},
+    {"Seated Cable Row", "strength", Pull, 45},
+    {"T-Bar Row", "strength", Pull, 40},
+    {"Face Pull", "strength", Pull, 15},
+    {"Barbell Curl", "strength", Pull, 25},
+    {"Hammer Curl", "strength", Pull, 12.5},
+    {"Preacher Curl", "strength", Pull, 20},
+    {"Rear Delt Fly", "strength", Pull, 7.5},
+    {"Back Squat", "strength", Legs, 70},
+    {"Front Squat", "strength", Legs, 50},
+    {"Romanian Deadlift", "strength", Legs, 60},
+    {"Leg Press", "strength", Legs, 120},
+    {"Walking Lunge", "strength", Legs, 15},
+    {"Bulgarian Split Squat", "strength", Legs, 12.5},
+    {"Leg Curl", "strength", Legs, 32.5},
+    {"Leg Extension", "strength", Legs, 35},
+    {"Standing Calf Raise", "strength", Legs, 55},
+    {"Hip Thrust", "strength", Legs, 60},
+    {"Hanging Leg Raise", "strength", Legs, 0},
+    {"Cable Crunch", "strength", Legs, 27.5},
+    {"Rowing Machine", "cardio", -1, 0},
+    {"Treadmill Run", "cardio", -1, 0},
+    {"Stationary Bike", "cardio", -1, 0},
+    {"Jump Rope", "cardio", -1, 0},
+    {"Hip Mobility Flow", "flexibility", -1, 0},
+    {"Hamstring Stretch", "flexibility", -1, 0},
+    {"Shoulder Dislocates", "flexibility", -1, 0},
+};
+const int CatalogSize = int(sizeof(Catalog) / sizeof(Catalog[0]));
+
+const char *const Variations[] = {"Paused", "Tempo", "Dumbbell", "Machine", "Cable", "Single-Arm", "Wide-Grip", "Close-Grip"};
+const int VariationCount = int(sizeof(Variations) / sizeof(Variations[0]));
+
+const char *const WeighInNotes[] = {
+    "Slept badly", "Big dinner last night", "Travel day", "Feeling lean", "Started new diet phase",
+    "Bloated", "Very hydrated", "Post-vacation", "Sick, low appetite", "Back on track",
+};
+const char *const WorkoutNotes[] = {
+    "Felt strong today", "Low energy, cut it short", "Gym was busy, swapped order", "New PR attempt",
+    "Shoulder a bit sore", "Deload week, kept it light", "Great pump", "Training with a partner",
+    "Short on time", "Knee felt fine after warm-up", "Focused on form", "Hot day, lots of water",
+};
+const char *const ExerciseNotes[] = {
+    "Left side weaker", "Use belt next time", "Grip gave out", "Slow eccentric", "Try wider stance",
+    "Elbow twinge on last set", "Easy, go up next time", "Paused reps", "Spotter needed",
+};
+
+template <int N>
+QString pick(QRandomGenerator &rng, const char *const (&bank)[N])
+{
+    return QString::fromLatin1(bank[rng.bounded(N)]);
+}
+
+double roundTo(double value, double step)
+{
+    return qRound(value / step) * step;
+}
+
+// Timestamps follow the entry's date so the output is reproducible
+QString stamp(const QDate &date, int minutesIntoDay)
+{
+    // Same shape as QDateTime::toString(Qt::ISODate) for local times
+    return date.toString(Qt::ISODate) + "T" + QTime(0, 0).addSecs(minutesIntoDay * 60).toString("HH:mm:ss");
+}
+
+struct ExerciseInfo {
+    int id;
+    QString name;
+    QString category;
+    int day;
+    double startLoad;
+};
+
+} // namespace
+
+DatasetGenerator::DatasetGenerator(const Options &options)
+    : m_options(options)
+{
+}
+
+QList<DatasetGenerator::Preset> DatasetGenerator::presets()
+{
+    return {
+        {"1y", 1, 1, "One athlete, one year"},
+        {"5y", 5, 1, "One athlete, five years"},
+        {"10y", 10, 1, "One athlete, ten years"},
+        {"25y", 25, 1, "One athlete, twenty-five years"},
+        {"50y", 50, 1, "One athlete, fifty years"},
+        {"team", 5, 25, "25 athletes, five years each"},
+        {"club", 10, 100, "100 athletes, ten years each"},
+        {"league", 20, 300, "300 athletes, twenty years each"},
+    };
+}
+
+bool DatasetGenerator::findPreset(const QString &name, Preset *preset)
+{
+    for (const Preset &candidate : presets()) {
+        if (candidate.name == name) {
+            *preset = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+QJsonObject DatasetGenerator::generate(int athlete, Summary *summary) const
+{
+    quint32 seeds[] = {m_options.seed, quint32(athlete)};
+    QRandomGenerator rng(seeds, seeds + 2);
+    Summary counts;
+
+    const QDate endDate = m_options.endDate;
+    const QDate startDate = endDate.addYears(-qMax(1, m_options.years)).addDays(1);
+
+    // The athlete
+    const bool isMale = rng.bounded(100) < 70;
+    const double height = isMale ? 66.0 + rng.bounded(9.0) : 61.0 + rng.bounded(8.0);
+    const double startWeight = isMale ? 165.0 + rng.bounded(65.0) : 125.0 + rng.bounded(60.0);
+    const double baseWaist = (isMale ? 32.0 : 28.0) + (startWeight - (isMale ? 180.0 : 145.0)) * 0.09;
+    const double baseNeck = isMale ? 15.0 + rng.bounded(2.5) : 12.5 + rng.bounded(2.0);
+    const double strength = 0.6 + rng.bounded(0.8);  // scales every starting load
+
+    // Exercise catalog: real names first, then variations to reach the count
+    QList<ExerciseInfo> exercises;
+    const int exerciseCount = qMax(1, m_options.exercises);
+    for (int i = 0; i < exerciseCount; ++i) {
+        const CatalogEntry &entry = Catalog[i % CatalogSize];
+        QString name = QString::fromLatin1(entry.name);
+        if (i >= CatalogSize) {
+            int round = i / CatalogSize - 1;
+            name = QString("%1 %2").arg(QString::fromLatin1(Variations[round % VariationCount]), name);
+            if (round >= VariationCount) {
+                name += QString(" %1").arg(round / VariationCount + 1);
+            }
+        }
+        exercises.append({i + 1, name, QString::fromLatin1(entry.category), entry.day, entry.startLoad * strength});
+    }
+
+    QJsonArray exercisesJson;
+    for (const ExerciseInfo &info : exercises) {
+        QJsonObject json = Exercise(info.id, info.name, info.category, rng.bounded(100) >= 5).toJson();
+        json["createdAt"] = stamp(startDate, 8 * 60);
+        json["updatedAt"] = stamp(startDate, 8 * 60);
+        exercisesJson.append(json);
+    }
+    counts.exercises = exercises.size();
+
+    QHash<int, QList<int>> byDay;  // Push/Pull/Legs/-1 -> exercise indexes
+    for (int i = 0; i < exercises.size(); ++i) {
+        byDay[exercises.at(i).day].append(i);
+    }
+
+    // Body composition: daily weigh-ins through cut/bulk phases
+    QJsonArray bodyCompositionJson;
+    double weight = startWeight;
+    double weeklyDrift = 0.0;
+    int phaseDaysLeft = 0;
+    int vacationDaysLeft = 0;
+    for (QDate date = startDate; date <= endDate; date = date.addDays(1)) {
+        if (phaseDaysLeft-- <= 0) {
+            phaseDaysLeft = 7 * (8 + rng.bounded(13));
+            weeklyDrift = rng.bounded(1.6) - 1.0;
+            // Pull back toward the starting weight over long histories
+            weeklyDrift -= (weight - startWeight) * 0.01;
+        }
+        weight += weeklyDrift / 7.0;
+
+        if (vacationDaysLeft > 0) {
+            --vacationDaysLeft;
+            continue;
+        }
+        if (rng.bounded(365) == 0) {
+            vacationDaysLeft = 7 + rng.bounded(8);
+        }
+        if (rng.bounded(100) < 12) {
+            continue;
+        }
+
+        double measured = roundTo(weight + rng.bounded(2.4) - 1.2, 0.1);
+        double waist = roundTo(baseWaist + (weight - startWeight) * 0.09 + rng.bounded(0.6) - 0.3, 0.1);
+        double neck = roundTo(baseNeck + (weight - startWeight) * 0.02 + rng.bounded(0.2) - 0.1, 0.1);
+        QString notes = rng.bounded(100) < 5 ? pick(rng, WeighInNotes) : QString();
+
+        QJsonObject json = BodyComposition(date, measured, waist, height, neck, notes, isMale).toJson();
+        json["timestamp"] = stamp(date, 7 * 60 + rng.bounded(90));
+        bodyCompositionJson.append(json);
+        ++counts.bodyCompositionEntries;
+        counts.notes += notes.isEmpty() ? 0 : 1;
+    }
+
+    // Workouts: push/pull/legs rotation with progressive overload
+    QJsonArray workoutsJson;
+    QHash<int, double> workingLoad;  // exercise index -> current working weight
+    const int perWeek = qBound(1, m_options.workoutsPerWeek, 7);
+    int workoutId = 0;
+    int workoutExerciseId = 0;
+    int rotation = 0;
+    for (QDate date = startDate; date <= endDate; date = date.addDays(1)) {
+        // Spread the sessions over the week, skip about one in ten
+        int dayOfWeek = date.dayOfWeek() - 1;
+        if ((dayOfWeek * perWeek) % 7 >= perWeek || rng.bounded(100) < 10) {
+            continue;
+        }
+
+        int week = startDate.daysTo(date) / 7;
+        bool deload = week % 8 == 7;
+        Day day = Day(rotation++ % 3);
+        ++workoutId;
+
+        QString notes = deload && rng.bounded(100) < 50 ? QString("Deload week, kept it light")
+                      : rng.bounded(100) < 20 ? pick(rng, WorkoutNotes) : QString();
+        Workout workout(workoutId, date, notes, Workout::Completed);
+        counts.notes += notes.isEmpty() ? 0 : 1;
+
+        const QList<int> &pool = byDay.value(day);
+        int exerciseSlots = qMin(pool.size(), 4 + int(rng.bounded(3)));
+        QList<int> chosen;
+        while (chosen.size() < exerciseSlots) {
+            int candidate = pool.at(rng.bounded(pool.size()));
+            if (!chosen.contains(candidate)) {
+                chosen.append(candidate);
+            }
+        }
+        const QList<int> &finishers = byDay.value(-1);
+        if (!finishers.isEmpty() && rng.bounded(100) < 25) {
+            chosen.append(finishers.at(rng.bounded(finishers.size())));
+        }
+
+        for (int index : chosen) {
+            const ExerciseInfo &info = exercises.at(index);
+            QList<SetData> sets;
+
+            if (info.day < 0) {
+                // Cardio and mobility: one block of minutes
+                sets.append(SetData(0.0, 10 + 5 * int(rng.bounded(4)), 1));
+            } else {
+                // Fast early gains that level off toward about twice the
+                // starting load over the years
+                double load = workingLoad.value(index, info.startLoad);
+                load += (info.startLoad * 2.0 - load) * 0.004 * (0.5 + rng.bounded(1.0));
+                workingLoad[index] = load;
+                double today = deload ? load * 0.85 : load;
+                double rounded = info.startLoad > 0 ? qMax(2.5, roundTo(today * (0.97 + rng.bounded(0.06)), 2.5)) : 0.0;
+
+                int setCount = 3 + int(rng.bounded(3));
+                int reps = 5 + int(rng.bounded(8));
+                if (rng.bounded(100) < 30) {
+                    // Logged as one straight-sets line, e.g. 3 x 8
+                    sets.append(SetData(rounded, reps, setCount));
+                } else {
+                    for (int s = 0; s < setCount; ++s) {
+                        int fatigue = s > 1 ? int(rng.bounded(s)) : 0;
+                        sets.append(SetData(rounded, qMax(1, reps - fatigue), 1));
+                    }
+                }
+            }
+            counts.sets += sets.size();
+
+            QString exerciseNotes = rng.bounded(100) < 8 ? pick(rng, ExerciseNotes) : QString();
+            counts.notes += exerciseNotes.isEmpty() ? 0 : 1;
+            workout.addExercise(WorkoutExercise(++workoutExerciseId, workoutId, info.id, info.name, sets, exerciseNotes));
+        }
+
+        // Workouts are logged in the evening; nested timestamps match
+        QJsonObject json = workout.toJson();
+        QString loggedAt = stamp(date, 18 * 60 + rng.bounded(180));
+        json["createdAt"] = loggedAt;
+        json["updatedAt"] = loggedAt;
+        QJsonArray exercisesArray = json["exercises"].toArray();
+        for (int i = 0; i < exercisesArray.size(); ++i) {
+            QJsonObject exerciseJson = exercisesArray.at(i).toObject();
+            exerciseJson["createdAt"] = loggedAt;
+            exerciseJson["updatedAt"] = loggedAt;
+            exercisesArray[i] = exerciseJson;
+        }
+        json["exercises"] = exercisesArray;
+        workoutsJson.append(json);
+        ++counts.workouts;
+    }
+
+    QJsonObject root;
+    root["bodyComposition"] = bodyCompositionJson;
+    root["exercises"] = exercisesJson;
+    root["workouts"] = workoutsJson;
+
+    if (summary) {
+        *summary = counts;
+    }
+    return root;
+}
+
+bool DatasetGenerator::writeFile(const QString &filePath, int athlete, Summary *summary) const
+{
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    return file.write(QJsonDocument(generate(athlete, summary)).toJson()) >= 0;
+}
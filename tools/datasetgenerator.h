@@ -0,0 +1,58 @@
+#ifndef DATASETGENERATOR_H
+#define DATASETGENERATOR_H
+
+#include <QDate>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+// Builds synthetic journals in the exact data.json layout DataManager reads.
+// Output depends only on the options and the athlete index, so a seed
+// reproduces the same bytes on every run (timestamps are derived from the
+// entry dates, never from the clock).
+//
+// Each athlete gets a body (sex, height, starting weight) and a training
+// history: daily weigh-ins with skipped days and cut/bulk phases, a
+// push/pull/legs split with progressive overload and deload weeks, and
+// occasional workout and exercise notes.
+class DatasetGenerator
+{
+public:
+    struct Options {
+        int years = 1;
+        int exercises = 60;
+        int workoutsPerWeek = 4;
+        quint32 seed = 1;
+        QDate endDate = QDate(2024, 12, 31);
+    };
+
+    // Named scales for load and scaling tests
+    struct Preset {
+        QString name;
+        int years;
+        int athletes;
+        QString description;
+    };
+
+    struct Summary {
+        int bodyCompositionEntries = 0;
+        int exercises = 0;
+        int workouts = 0;
+        int sets = 0;
+        int notes = 0;
+    };
+
+    explicit DatasetGenerator(const Options &options);
+
+    static QList<Preset> presets();
+    static bool findPreset(const QString &name, Preset *preset);
+
+    // One athlete's journal; athletes with different indexes differ
+    QJsonObject generate(int athlete = 0, Summary *summary = nullptr) const;
+    bool writeFile(const QString &filePath, int athlete = 0, Summary *summary = nullptr) const;
+
+private:
+    Options m_options;
+};
+
+#endif // DATASETGENERATOR_H
@@ -0,0 +1,102 @@
+// Writes reproducible synthetic journals in DataManager's data.json format.
+//
+// Usage:
+//   generate-dataset --preset 10y --out data.json
+//   generate-dataset --preset club --out datasets/club
+//   generate-dataset --years 3 --athletes 5 --exercises 80 --seed 7 --out out/
+//   generate-dataset --list-presets
+//
+// A single athlete is written to --out as a file. Several athletes are
+// written to --out as a directory, one athlete-NNN/data.json per athlete.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <cstdio>
+#include "datasetgenerator.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("generate-dataset");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generate synthetic fitness journals for load and scaling tests.");
+    parser.addHelpOption();
+    QCommandLineOption presetOption("preset", "Scaling preset (see --list-presets).", "name");
+    QCommandLineOption listOption("list-presets", "List the scaling presets and exit.");
+    QCommandLineOption yearsOption("years", "Years of history per athlete.", "n", "1");
+    QCommandLineOption athletesOption("athletes", "Number of athletes.", "n", "1");
+    QCommandLineOption exercisesOption("exercises", "Exercises in each catalog.", "n", "60");
+    QCommandLineOption perWeekOption("workouts-per-week", "Planned sessions per week.", "n", "4");
+    QCommandLineOption seedOption("seed", "Random seed.", "n", "1");
+    QCommandLineOption endOption("end-date", "Last day of history (YYYY-MM-DD).", "date", "2024-12-31");
+    QCommandLineOption outOption("out", "Output file (one athlete) or directory (several).", "path");
+    parser.addOptions({presetOption, listOption, yearsOption, athletesOption, exercisesOption,
+                       perWeekOption, seedOption, endOption, outOption});
+    parser.process(app);
+
+    if (parser.isSet(listOption)) {
+        for (const DatasetGenerator::Preset &preset : DatasetGenerator::presets()) {
+            printf("%-8s %3d years x %3d athletes  %s\n", qPrintable(preset.name), preset.years,
+                   preset.athletes, qPrintable(preset.description));
+        }
+        return 0;
+    }
+
+    DatasetGenerator::Options options;
+    options.years = parser.value(yearsOption).toInt();
+    options.exercises = parser.value(exercisesOption).toInt();
+    options.workoutsPerWeek = parser.value(perWeekOption).toInt();
+    options.seed = parser.value(seedOption).toUInt();
+    options.endDate = QDate::fromString(parser.value(endOption), Qt::ISODate);
+    int athletes = parser.value(athletesOption).toInt();
+
+    if (parser.isSet(presetOption)) {
+        DatasetGenerator::Preset preset;
+        if (!DatasetGenerator::findPreset(parser.value(presetOption), &preset)) {
+            fprintf(stderr, "Unknown preset '%s'; see --list-presets\n", qPrintable(parser.value(presetOption)));
+            return 1;
+        }
+        // Explicit options still override the preset
+        if (!parser.isSet(yearsOption)) {
+            options.years = preset.years;
+        }
+        if (!parser.isSet(athletesOption)) {
+            athletes = preset.athletes;
+        }
+    }
+
+    QString out = parser.value(outOption);
+    if (out.isEmpty() || !options.endDate.isValid() || options.years < 1 || athletes < 1) {
+        parser.showHelp(1);
+    }
+
+    DatasetGenerator generator(options);
+    QElapsedTimer timer;
+    timer.start();
+
+    DatasetGenerator::Summary total;
+    qint64 bytes = 0;
+    for (int athlete = 0; athlete < athletes; ++athlete) {
+        QString path = athletes == 1 ? out : QString("%1/athlete-%2/data.json").arg(out).arg(athlete + 1, 3, 10, QChar('0'));
+        DatasetGenerator::Summary summary;
+        if (!generator.writeFile(path, athlete, &summary)) {
+            fprintf(stderr, "Cannot write %s\n", qPrintable(path));
+            return 1;
+        }
+        bytes += QFileInfo(path).size();
+        total.bodyCompositionEntries += summary.bodyCompositionEntries;
+        total.workouts += summary.workouts;
+        total.sets += summary.sets;
+        total.notes += summary.notes;
+        total.exercises = summary.exercises;
+    }
+
+    printf("%d athlete(s), %d year(s), seed %u -> %s\n", athletes, options.years, options.seed, qPrintable(out));
+    printf("  body composition: %d  workouts: %d  sets: %d  notes: %d  exercises: %d\n",
+           total.bodyCompositionEntries, total.workouts, total.sets, total.notes, total.exercises);
+    printf("  %.1f MiB in %.1f s\n", bytes / (1024.0 * 1024.0), timer.elapsed() / 1000.0);
+    return 0;
+}